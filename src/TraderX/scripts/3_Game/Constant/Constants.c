@@ -26,6 +26,14 @@ const string TRADERX_PRODUCT_FILE = TRADERX_PRODUCTS_DIR + "%1.json";  // %1 = p
 const string TRADERX_STOCK_DIR = TRADERX_DB_DIR_SERVER + "Stock\\";
 const string TRADERX_STOCK_FILE = TRADERX_STOCK_DIR + "%1.json";  // %1 = stockId
 
+// Stock journal storage (single snapshot + append-only journal)
+const string TRADERX_STOCK_SNAPSHOT_FILE = TRADERX_DB_DIR_SERVER + "StockSnapshot.txt";
+const string TRADERX_STOCK_SNAPSHOT_TMP_FILE = TRADERX_DB_DIR_SERVER + "StockSnapshot.tmp";
+const string TRADERX_STOCK_JOURNAL_FILE = TRADERX_DB_DIR_SERVER + "StockJournal.txt";
+
+// Client catalog cache, content-addressed by the server catalog hash
+const string TRADERX_CATALOG_CACHE_DIR = TRADERX_CONFIG_ROOT_SERVER + "CatalogCache\\";
+const string TRADERX_CATALOG_CACHE_FILE = TRADERX_CATALOG_CACHE_DIR + "Catalog_%1.json";  // %1 = catalog hash
 
 // Player Licenses
 const string TRADERX_PLAYER_LICENSES_DIR = TRADERX_DB_DIR_SERVER + "PlayerLicenses\\";
@@ -45,12 +53,24 @@ const string TRADERX_DEBUG_TEST_CASE_FILE = TRADERX_DEBUG_TEST_CASES_DIR + "%1.j
 // Debug settings
 const string TRADERX_DEBUG_SETTINGS_FILE = TRADERX_CONFIG_DIR_SERVER + "TraderXDebugSettings.json";
 
+// Performance settings
+const string TRADERX_PERFORMANCE_SETTINGS_FILE = TRADERX_CONFIG_DIR_SERVER + "TraderXPerformanceSettings.json";
+
+// Transaction pipeline metrics, Prometheus textfile collector format
+const string TRADERX_METRICS_DIR = TRADERX_CONFIG_ROOT_SERVER + "Logs\\";
+const string TRADERX_METRICS_FILE = TRADERX_METRICS_DIR + "traderx_metrics.prom";
+const string TRADERX_METRICS_TMP_FILE = TRADERX_METRICS_DIR + "traderx_metrics.prom.tmp";
+
+// TickCount() resolution, used to measure per-frame time budgets
+const int TRADERX_TICKS_PER_MS = 10000;
+
 // Logger - MUST be defined before dependent constants
 const string TRADERX_LOG_FOLDER = TRADERX_CONFIG_ROOT_SERVER + "TraderXLogs\\";
 const string TRADERX_LOGGER_CONFIG_DIR = TRADERX_LOG_FOLDER + "Config\\";
 const string TRADERX_LOGGER_CONFIG_FILE = TRADERX_LOGGER_CONFIG_DIR + "LoggingSettings.json";
 const string TRADERX_LOGGER_LOG_DIR = TRADERX_LOG_FOLDER + "Logs\\";
 const string TRADERX_LOGGER_LOG_FILE = TRADERX_LOGGER_LOG_DIR + "TraderX_%1.log";
+const string TRADERX_LOAD_TEST_RESULTS_FILE = TRADERX_LOGGER_LOG_DIR + "LoadTest_%1.log";  // %1 = timestamp
 
 // CSV Configuration System
 const string TRADERX_CSV_SOURCE_DIR = TRADERX_CONFIG_DIR_SERVER + "Source\\";
@@ -60,6 +80,8 @@ const string TRADERX_BACKUP_DIR = TRADERX_CONFIG_DIR_SERVER + "Backup\\";
 // Compiled configuration files
 const string TRADERX_COMPILED_PRODUCTS_FILE = TRADERX_COMPILED_DIR + "Products_compiled.json";
 const string TRADERX_COMPILED_CATEGORIES_FILE = TRADERX_COMPILED_DIR + "Categories_compiled.json";
+const string TRADERX_COMPILED_CATALOG_BINARY_FILE = TRADERX_COMPILED_DIR + "Catalog_compiled.bin";
+const string TRADERX_BUILD_MANIFEST_FILE = TRADERX_COMPILED_DIR + "BuildManifest.json";
 
 // Backup files
 const string TRADERX_COMPILED_PRODUCTS_BACKUP = TRADERX_BACKUP_DIR + "Products_compiled.json.backup";
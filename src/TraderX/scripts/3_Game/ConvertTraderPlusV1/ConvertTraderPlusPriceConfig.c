@@ -218,12 +218,14 @@ class oldTraderXPriceConfig
     }
 
 	static void ConvertOldConfigToNew()	{
+		// Nothing to convert once the V1 file was moved to deleted/
+		if (!FileExist(TRADERX_CONFIG_DIR_SERVER + "TraderXPriceConfig.json"))
+			return;
+
 		oldTraderXPriceConfig config = new oldTraderXPriceConfig();
-		if (FileExist(TRADERX_CONFIG_DIR_SERVER + "TraderXPriceConfig.json")) {
-			GetTraderXLogger().LogInfo("Load old V1 PriceConfig for conversion...");
-			TraderXJsonLoader<oldTraderXPriceConfig>.LoadFromFile(TRADERX_CONFIG_DIR_SERVER + "TraderXPriceConfig.json", config);
-            GetTraderXLogger().LogInfo("Load done.");
-		}
+		GetTraderXLogger().LogInfo("Load old V1 PriceConfig for conversion...");
+		TraderXJsonLoader<oldTraderXPriceConfig>.LoadFromFile(TRADERX_CONFIG_DIR_SERVER + "TraderXPriceConfig.json", config);
+		GetTraderXLogger().LogInfo("Load done.");
 
         config.ConvertToNewConfig();
 	}
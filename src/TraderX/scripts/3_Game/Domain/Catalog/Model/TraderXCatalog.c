@@ -0,0 +1,40 @@
+/**
+ * TraderXCatalog - Everything a client needs to browse the traders: categories and products
+ * The hash identifies the content, the client keeps a copy keyed by it and only asks the server
+ * for the full catalog when it has no copy for the announced hash.
+ */
+class TraderXCatalog
+{
+    string version = TRADERX_CURRENT_VERSION;
+    string hash;
+    ref array<ref TraderXCategory> categories;
+    ref array<ref TraderXProduct> products;
+
+    void TraderXCatalog()
+    {
+        categories = new array<ref TraderXCategory>();
+        products = new array<ref TraderXProduct>();
+    }
+
+    static TraderXCatalog CreateFromRepositories()
+    {
+        TraderXCatalog catalog = new TraderXCatalog();
+        catalog.categories = TraderXCategoryRepository.GetCategories();
+        catalog.products = TraderXProductRepository.GetProducts();
+        return catalog;
+    }
+
+    bool IsEmpty()
+    {
+        return categories.Count() == 0 && products.Count() == 0;
+    }
+
+    /**
+     * Hash of serialized catalog content
+     * The length is part of the key to make collisions on the 32 bit hash even less likely
+     */
+    static string ComputeHash(string content)
+    {
+        return string.Format("%1_%2", content.Hash(), content.Length());
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * TraderXCatalogPayload - The catalog serialized once, ready to be sent as is
+ * The JSON is cut into chunks so no single RPC string grows unbounded. Every requester receives
+ * the same chunks, nothing is re-serialized per player.
+ */
+class TraderXCatalogPayload
+{
+    static const int CHUNK_SIZE = 16384;
+
+    private string m_Hash;
+    private ref TStringArray m_Chunks;
+    private int m_Size;
+
+    void TraderXCatalogPayload(string hash, TStringArray chunks, int size)
+    {
+        m_Hash = hash;
+        m_Chunks = chunks;
+        m_Size = size;
+    }
+
+    static TraderXCatalogPayload Build(TraderXCatalog catalog)
+    {
+        string content = TraderXJsonLoader<TraderXCatalog>.ObjectToString(catalog);
+        int size = content.Length();
+
+        TStringArray chunks = new TStringArray();
+        for (int start = 0; start < size; start += CHUNK_SIZE)
+        {
+            chunks.Insert(content.Substring(start, Math.Min(CHUNK_SIZE, size - start)));
+        }
+
+        return new TraderXCatalogPayload(TraderXCatalog.ComputeHash(content), chunks, size);
+    }
+
+    /**
+     * Client side: rebuild the catalog from received chunks
+     * @return null when the content does not parse
+     */
+    static TraderXCatalog ToCatalog(string hash, TStringArray chunks)
+    {
+        string content = string.Empty;
+        foreach (string chunk : chunks)
+        {
+            content += chunk;
+        }
+
+        TraderXCatalog catalog = new TraderXCatalog();
+        TraderXJsonLoader<TraderXCatalog>.StringToObject(content, catalog);
+        if (!catalog || catalog.IsEmpty())
+            return null;
+
+        catalog.hash = hash;
+        return catalog;
+    }
+
+    string GetHash()
+    {
+        return m_Hash;
+    }
+
+    TStringArray GetChunks()
+    {
+        return m_Chunks;
+    }
+
+    int GetSize()
+    {
+        return m_Size;
+    }
+}
@@ -0,0 +1,81 @@
+/**
+ * TraderXCatalogCacheRepository - Client-side persisted copies of the server catalog
+ * One file per catalog hash, older copies are removed when a new one is stored.
+ */
+class TraderXCatalogCacheRepository
+{
+    static bool Has(string hash)
+    {
+        return hash != string.Empty && FileExist(GetFilePath(hash));
+    }
+
+    static TraderXCatalog Load(string hash)
+    {
+        if (!Has(hash))
+            return null;
+
+        TraderXCatalog catalog = new TraderXCatalog();
+        TraderXJsonLoader<TraderXCatalog>.LoadFromFile(GetFilePath(hash), catalog);
+
+        // A truncated or foreign file is treated as a cache miss
+        if (!catalog || catalog.hash != hash || catalog.IsEmpty())
+        {
+            GetTraderXLogger().LogWarning("[CATALOG CACHE] Discarding unusable cached catalog " + hash);
+            DeleteFile(GetFilePath(hash));
+            return null;
+        }
+
+        return catalog;
+    }
+
+    static void Save(TraderXCatalog catalog)
+    {
+        if (!catalog || catalog.hash == string.Empty)
+            return;
+
+        MakeDirectoriesIfNotExist();
+        PurgeAllExcept(catalog.hash);
+        TraderXJsonLoader<TraderXCatalog>.SaveToFile(GetFilePath(catalog.hash), catalog);
+    }
+
+    private static void PurgeAllExcept(string hash)
+    {
+        string keepFile = string.Format("Catalog_%1.json", hash);
+        array<string> staleFiles = new array<string>();
+
+        string filename;
+        FileAttr attr;
+        FindFileHandle findHandle = FindFile(TRADERX_CATALOG_CACHE_DIR + "Catalog_*.json", filename, attr, FindFileFlags.ALL);
+        if (findHandle == 0)
+            return;
+
+        bool hasFile = true;
+        while (hasFile)
+        {
+            if (filename != keepFile)
+                staleFiles.Insert(filename);
+
+            hasFile = FindNextFile(findHandle, filename, attr);
+        }
+        CloseFindFile(findHandle);
+
+        foreach (string staleFile : staleFiles)
+        {
+            DeleteFile(TRADERX_CATALOG_CACHE_DIR + staleFile);
+        }
+    }
+
+    private static string GetFilePath(string hash)
+    {
+        return string.Format(TRADERX_CATALOG_CACHE_FILE, hash);
+    }
+
+    private static void MakeDirectoriesIfNotExist()
+    {
+        if (!FileExist(TRADERX_CONFIG_ROOT_SERVER))
+            MakeDirectory(TRADERX_CONFIG_ROOT_SERVER);
+
+        if (!FileExist(TRADERX_CATALOG_CACHE_DIR))
+            MakeDirectory(TRADERX_CATALOG_CACHE_DIR);
+    }
+}
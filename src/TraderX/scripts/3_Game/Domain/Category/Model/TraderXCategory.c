@@ -66,15 +66,14 @@ class TraderXCategory extends TraderXJsonCategory
         return products;
     }
 
+    // Linear scan, trader menus match through TraderXTraderProductIndex instead
     TraderXProduct FindProductByClassName(string className)
     {
-        array<ref TraderXProduct> products = GetProducts();
-        foreach(TraderXProduct product: products)
+        foreach(string productId : productIds)
         {
-            if(CF_String.EqualsIgnoreCase(product.className, className)){
-                GetTraderXLogger().LogDebug("FindProductByClassName : " + product.className);
+            TraderXProduct product = TraderXProductRepository.GetItemById(productId);
+            if(product && CF_String.EqualsIgnoreCase(product.className, className))
                 return product;
-            }
         }
 
         return null;
@@ -0,0 +1,93 @@
+/**
+ * TraderXTraderProductIndex - className lookup over the categories of one trader
+ * Built once when a trader menu opens: lowercase className -> products carrying it, in
+ * category order, with the position of the category each one came from, kept per entry since
+ * a product can be listed in several categories of the same trader. Matching player items against
+ * the trader becomes one map lookup per item instead of a scan per category.
+ */
+class TraderXTraderProductIndex
+{
+    private ref map<string, ref array<TraderXProduct>> m_ProductsByClassName;
+    private ref map<string, ref TIntArray> m_CategoryIndicesByClassName;
+
+    void TraderXTraderProductIndex()
+    {
+        m_ProductsByClassName = new map<string, ref array<TraderXProduct>>();
+        m_CategoryIndicesByClassName = new map<string, ref TIntArray>();
+    }
+
+    void Build(array<ref TraderXCategory> categories)
+    {
+        Clear();
+
+        foreach (int categoryIndex, TraderXCategory category : categories)
+        {
+            if (!category || !category.productIds)
+                continue;
+
+            foreach (string productId : category.productIds)
+            {
+                TraderXProduct product = TraderXProductRepository.GetItemById(productId);
+                if (!product)
+                    continue;
+
+                string className = product.className;
+                className.ToLower();
+
+                array<TraderXProduct> products = m_ProductsByClassName.Get(className);
+                TIntArray categoryIndices = m_CategoryIndicesByClassName.Get(className);
+                if (!products)
+                {
+                    products = new array<TraderXProduct>();
+                    categoryIndices = new TIntArray();
+                    m_ProductsByClassName.Set(className, products);
+                    m_CategoryIndicesByClassName.Set(className, categoryIndices);
+                }
+
+                // A category lists a className once, like FindProductByClassName returning the first match
+                if (categoryIndices.Find(categoryIndex) != -1)
+                    continue;
+
+                products.Insert(product);
+                categoryIndices.Insert(categoryIndex);
+            }
+        }
+    }
+
+    void Clear()
+    {
+        m_ProductsByClassName.Clear();
+        m_CategoryIndicesByClassName.Clear();
+    }
+
+    /**
+     * Products matching a className, one per category that sells it
+     * @param className any case
+     */
+    array<TraderXProduct> FindProducts(string className)
+    {
+        string key = className;
+        key.ToLower();
+        return m_ProductsByClassName.Get(key);
+    }
+
+    TraderXProduct FindProduct(string className)
+    {
+        array<TraderXProduct> products = FindProducts(className);
+        if (!products || products.Count() == 0)
+            return null;
+
+        return products[0];
+    }
+
+    /**
+     * Category positions of FindProducts, entry for entry
+     * @param className any case
+     */
+    TIntArray FindCategoryIndices(string className)
+    {
+        string key = className;
+        key.ToLower();
+        return m_CategoryIndicesByClassName.Get(key);
+    }
+}
@@ -131,96 +131,46 @@ class TraderXCategoryRepository
         TraderXJsonLoader<map<string, ref TraderXCategory>>.SaveToFile(TRADERX_CONFIG_DIR_SERVER + "MapAllCategories.json", s_Categories);
     }
 
-    static void LoadAllCategories()
+    /**
+     * Map one entry of the compiled categories file into the repository
+     * @return false when the entry is null, has no categoryId or fails to map
+     */
+    static bool AddCompiledCategory(TraderXCompiledCategory jsonCategory)
     {
-        GetTraderXLogger().LogInfo("[TraderX] LoadAllCategories - Starting");
+        if (!jsonCategory)
+            return false;
         
-        // Try compiled JSON first (CSV-based system)
-        if (FileExist(TRADERX_COMPILED_CATEGORIES_FILE))
+        // Validate required fields
+        if (jsonCategory.categoryId.Length() == 0)
         {
-            GetTraderXLogger().LogInfo("[TraderX] Loading categories from compiled config");
-            LoadFromCompiledJson();
-            return;
+            GetTraderXLogger().LogWarning("[TraderX] Skipping category with empty categoryId in compiled file");
+            return false;
         }
         
-        // Fallback to legacy multi-file JSON
-        GetTraderXLogger().LogWarning("[TraderX] Compiled config not found, using legacy multi-file JSON");
-        LoadFromLegacyJson();
+        TraderXCategory category = TraderXCategoryMapper.MapToTraderXCategory(jsonCategory);
+        if (!category)
+            return false;
+        
+        category.categoryId = jsonCategory.categoryId;
+        if (category.categoryId.Length() == 0)
+            return false;
+        
+        s_Categories.Set(category.categoryId, category);
+        return true;
     }
     
-    // Load categories from compiled JSON (CSV-based system)
-    private static void LoadFromCompiledJson()
+    static void ClearCategories()
     {
-        ref array<ref TraderXCompiledCategory> jsonCategories = new array<ref TraderXCompiledCategory>;
-        JsonFileLoader<array<ref TraderXCompiledCategory>>.JsonLoadFile(TRADERX_COMPILED_CATEGORIES_FILE, jsonCategories);
-        
-        if (!jsonCategories || jsonCategories.Count() == 0)
-        {
-            GetTraderXLogger().LogError("[TraderX] Failed to load compiled categories (empty or null), falling back to legacy");
-            LoadFromLegacyJson();
-            return;
-        }
-        
         s_Categories.Clear();
-        int successCount = 0;
-        int failCount = 0;
-        
-        foreach (TraderXCompiledCategory jsonCategory : jsonCategories)
-        {
-            if (!jsonCategory)
-            {
-                failCount++;
-                continue;
-            }
-            
-            // Validate required fields
-            if (jsonCategory.categoryId.Length() == 0)
-            {
-                GetTraderXLogger().LogWarning("[TraderX] Skipping category with empty categoryId in compiled file");
-                failCount++;
-                continue;
-            }
-            
-            TraderXCategory category = TraderXCategoryMapper.MapToTraderXCategory(jsonCategory);
-            if (category)
-            {
-                category.categoryId = jsonCategory.categoryId;
-                if (category.categoryId.Length() > 0)
-                {
-                    s_Categories.Set(category.categoryId, category);
-                    successCount++;
-                }
-                else
-                {
-                    failCount++;
-                }
-            }
-            else
-            {
-                failCount++;
-            }
-        }
-        
-        // If too many failures, fall back to legacy
-        if (successCount == 0 && failCount > 0)
-        {
-            GetTraderXLogger().LogError(string.Format("[TraderX] All %1 categories failed to load from compiled file, falling back to legacy", failCount));
-            LoadFromLegacyJson();
-            return;
-        }
-        
-        if (failCount > 0)
-        {
-            GetTraderXLogger().LogWarning(string.Format("[TraderX] Loaded %1 categories from compiled file, %2 failed", successCount, failCount));
-        }
-        else
-        {
-            GetTraderXLogger().LogInfo(string.Format("[TraderX] LoadAllCategories - Completed. Total categories loaded: %1 (from compiled config)", s_Categories.Count()));
-        }
+    }
+    
+    static int GetCategoryCount()
+    {
+        return s_Categories.Count();
     }
     
     // Load categories from legacy multi-file JSON (backward compatibility)
-    private static void LoadFromLegacyJson()
+    static void LoadFromLegacyJson()
     {
         if (!FileExist(TRADERX_CATEGORIES_DIR)){
             GetTraderXLogger().LogDebug("[TraderX] Categories directory doesn't exist, creating: " + TRADERX_CATEGORIES_DIR);
@@ -0,0 +1,126 @@
+/**
+ * TraderXNpcTradeView - Everything a trader offers, derived once from its config
+ * Holds the category, product and accepted currency sets and how many sellable products each
+ * category has. Built by TraderXNpcTradeViewRepository
+ * after config or catalog load and never modified afterwards, rebuild the views instead.
+ */
+class TraderXNpcTradeView
+{
+    private TraderXNpc m_Npc;
+
+    private ref TStringArray m_CategoryIds;
+    private ref map<string, bool> m_CategorySet;
+    private ref map<string, bool> m_ProductSet;
+    private ref map<string, bool> m_CurrencySet;
+    private ref map<string, int> m_SellableCountByCategory;
+
+    void TraderXNpcTradeView(TraderXNpc npc)
+    {
+        m_Npc = npc;
+        m_CategoryIds = new TStringArray();
+        m_CategorySet = new map<string, bool>();
+        m_ProductSet = new map<string, bool>();
+        m_CurrencySet = new map<string, bool>();
+        m_SellableCountByCategory = new map<string, int>();
+    }
+
+    static TraderXNpcTradeView Create(TraderXNpc npc)
+    {
+        TraderXNpcTradeView view = new TraderXNpcTradeView(npc);
+
+        if (npc.currenciesAccepted)
+        {
+            foreach (string currency : npc.currenciesAccepted)
+            {
+                view.m_CurrencySet.Set(currency, true);
+            }
+        }
+
+        if (npc.categoriesId)
+        {
+            foreach (string categoryId : npc.categoriesId)
+            {
+                view.AddCategory(categoryId);
+            }
+        }
+
+        return view;
+    }
+
+    TraderXNpc GetNpc()
+    {
+        return m_Npc;
+    }
+
+    int GetNpcId()
+    {
+        return m_Npc.npcId;
+    }
+
+    // Category ids in config order, categories missing from the catalog are skipped
+    TStringArray GetCategoryIds()
+    {
+        return m_CategoryIds;
+    }
+
+    bool HasCategory(string categoryId)
+    {
+        return m_CategorySet.Contains(categoryId);
+    }
+
+    bool SellsProduct(string productId)
+    {
+        return m_ProductSet.Contains(productId);
+    }
+
+    map<string, bool> GetProductIds()
+    {
+        return m_ProductSet;
+    }
+
+    // An empty currenciesAccepted list accepts every currency type, as TraderXCurrencyService does
+    bool AcceptsCurrency(string currencyType)
+    {
+        return m_CurrencySet.Count() == 0 || m_CurrencySet.Contains(currencyType);
+    }
+
+    TStringArray GetCurrenciesAccepted()
+    {
+        return m_Npc.currenciesAccepted;
+    }
+
+    int GetSellableCount(string categoryId)
+    {
+        return m_SellableCountByCategory.Get(categoryId);
+    }
+
+    bool HasSellableProducts(string categoryId)
+    {
+        return GetSellableCount(categoryId) > 0;
+    }
+
+    private void AddCategory(string categoryId)
+    {
+        TraderXCategory category = TraderXCategoryRepository.GetCategoryById(categoryId);
+        if (!category || m_CategorySet.Contains(categoryId))
+            return;
+
+        m_CategoryIds.Insert(categoryId);
+        m_CategorySet.Set(categoryId, true);
+
+        int sellable = 0;
+        foreach (string productId : category.productIds)
+        {
+            m_ProductSet.Set(productId, true);
+
+            TraderXProduct product = TraderXProductRepository.GetItemById(productId);
+            if (!product)
+                continue;
+
+            if (product.CanBeSold())
+                sellable++;
+        }
+
+        m_SellableCountByCategory.Set(categoryId, sellable);
+    }
+}
@@ -0,0 +1,43 @@
+/**
+ * TraderXNpcTradeViewRepository - Trade views indexed by npc id
+ * Rebuilt as a whole whenever the npc list or the catalog changes: after config load on the server,
+ * after the general config or the catalog arrives on the client.
+ */
+class TraderXNpcTradeViewRepository
+{
+    private static ref map<int, ref TraderXNpcTradeView> s_Views = new map<int, ref TraderXNpcTradeView>();
+
+    static void Build(array<ref TraderXNpc> traders)
+    {
+        s_Views.Clear();
+        if (!traders)
+            return;
+
+        foreach (TraderXNpc npc : traders)
+        {
+            if (npc)
+                s_Views.Set(npc.npcId, TraderXNpcTradeView.Create(npc));
+        }
+
+        GetTraderXLogger().LogDebug(string.Format("[NPC] %1 trade views built", s_Views.Count()));
+    }
+
+    static TraderXNpcTradeView GetView(int npcId)
+    {
+        return s_Views.Get(npcId);
+    }
+
+    static TraderXNpc GetNpc(int npcId)
+    {
+        TraderXNpcTradeView view = s_Views.Get(npcId);
+        if (!view)
+            return null;
+
+        return view.GetNpc();
+    }
+
+    static void Clear()
+    {
+        s_Views.Clear();
+    }
+}
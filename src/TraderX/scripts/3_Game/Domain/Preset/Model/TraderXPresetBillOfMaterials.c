@@ -0,0 +1,72 @@
+/**
+ * TraderXPresetBillOfMaterials - A preset flattened to distinct products and their counts
+ * The main item and every attachment are merged, so a preset with the same attachment twice
+ * is priced with one progressive computation for that product instead of one per occurrence.
+ */
+class TraderXPresetBillOfMaterials
+{
+    // Main product and ordered attachment ids, presets sent by clients are only trusted for their content
+    string contentKey;
+
+    ref TStringArray productIds;
+    ref TIntArray counts;
+
+    void TraderXPresetBillOfMaterials()
+    {
+        productIds = new TStringArray();
+        counts = new TIntArray();
+    }
+
+    static TraderXPresetBillOfMaterials Compile(TraderXPreset preset)
+    {
+        TraderXPresetBillOfMaterials bom = new TraderXPresetBillOfMaterials();
+        bom.contentKey = GetContentKey(preset);
+
+        bom.Add(preset.productId);
+        if (preset.attachments)
+        {
+            foreach (string attachmentId : preset.attachments)
+            {
+                bom.Add(attachmentId);
+            }
+        }
+        return bom;
+    }
+
+    // Still describes the preset, attachments of client presets can be edited in place
+    bool Matches(TraderXPreset preset)
+    {
+        return contentKey == GetContentKey(preset);
+    }
+
+    static string GetContentKey(TraderXPreset preset)
+    {
+        string key = preset.productId;
+        if (preset.attachments)
+        {
+            foreach (string attachmentId : preset.attachments)
+            {
+                key += "|" + attachmentId;
+            }
+        }
+        return key;
+    }
+
+    int Count()
+    {
+        return productIds.Count();
+    }
+
+    private void Add(string productId)
+    {
+        int index = productIds.Find(productId);
+        if (index == -1)
+        {
+            productIds.Insert(productId);
+            counts.Insert(1);
+            return;
+        }
+
+        counts[index] = counts[index] + 1;
+    }
+}
@@ -43,19 +43,8 @@ class TraderXPriceCalculation
             return Math.Round(basePrice * multiplier * stateMultiplier);
         
         // Apply coefficient-based pricing for limited stock with dynamic pricing
-        float totalPrice = 0;
-        int currentStockForCalculation = stockQuantity;
-        
-        for (int i = 1; i <= multiplier; i++)
-        {
-            int stockLevel = currentStockForCalculation;
-            if (stockLevel == 0) stockLevel = 1; // Prevent division by zero in coefficient calculation
-            
-            float priceForThisUnit = Math.Pow(coefficient, (stockLevel - 1)) * basePrice * stateMultiplier;
-            totalPrice += priceForThisUnit;
-            
-            currentStockForCalculation++;
-        }
+        // Each unit is priced one stock level higher than the previous one, see TraderXPriceKernel
+        float totalPrice = TraderXPriceKernel.GetProgressiveFactor(coefficient, stockQuantity, multiplier) * basePrice * stateMultiplier;
         
         int finalPrice = Math.Round(totalPrice);
         if (finalPrice == 0) finalPrice = 1; // Minimum price of 1
@@ -75,17 +64,7 @@ class TraderXPriceCalculation
         
         // For sell transactions with multiplier > 1, calculate progressive pricing
         // Each item sold increases trader's stock, making subsequent items worth less
-        float totalPrice = 0;
-        int currentStockForCalculation = stockQuantity;
-        
-        for (int i = 0; i < multiplier; i++)
-        {
-            int stockLevel = currentStockForCalculation + i;
-            if (stockLevel <= 0) stockLevel = 1; // Prevent division by zero
-            
-            float priceForThisUnit = Math.Pow(coefficient, (stockLevel - 1)) * basePrice * stateMultiplier;
-            totalPrice += priceForThisUnit;
-        }
+        float totalPrice = TraderXPriceKernel.GetProgressiveFactor(coefficient, stockQuantity, multiplier) * basePrice * stateMultiplier;
         
         int finalPrice = Math.Round(totalPrice);
         if (finalPrice == 0) finalPrice = 1; // Minimum price of 1
@@ -152,10 +131,7 @@ class TraderXPriceCalculation
         
         for (int j = 0; j < multiplier; j++)
         {
-            int stockLevel = currentStockForCalculation + j;
-            if (stockLevel <= 0) stockLevel = 1;
-            
-            float priceForThisUnit = Math.Pow(coefficient, (stockLevel - 1)) * basePrice * stateMultiplier;
+            float priceForThisUnit = TraderXPriceKernel.GetUnitFactor(coefficient, currentStockForCalculation + j) * basePrice * stateMultiplier;
             int roundedPrice = Math.Round(priceForThisUnit);
             if (roundedPrice == 0) roundedPrice = 1;
             
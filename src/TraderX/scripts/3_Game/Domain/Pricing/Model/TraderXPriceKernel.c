@@ -0,0 +1,108 @@
+/**
+ * TraderXPriceKernel - Progressive pricing without per-unit loops
+ * A batch of n units starting at stock level s costs base * state * c^(s-1) * (1 + c + ... + c^(n-1)).
+ * Both factors come from tables built once per coefficient by repeated multiplication: powers[e] = c^e
+ * and geometric[n] = 1 + c + ... + c^(n-1). A batch total is then two lookups and one rounding.
+ * Coefficients are keyed in fixed point (parts per million) so client and server share the same
+ * tables and produce identical totals, whatever float noise the coefficient carried over the wire.
+ */
+class TraderXPriceKernel
+{
+    static const int COEFFICIENT_SCALE = 1000000;
+    // Past this the tables stop growing and the closed form takes over
+    static const int MAX_TABLE_SIZE = 65536;
+
+    private static ref map<int, ref array<float>> s_PowersByCoefficient = new map<int, ref array<float>>();
+    private static ref map<int, ref array<float>> s_GeometricByCoefficient = new map<int, ref array<float>>();
+
+    static int ToFixedCoefficient(float coefficient)
+    {
+        return Math.Round(coefficient * COEFFICIENT_SCALE);
+    }
+
+    /**
+     * Sum of c^(level-1) for the units at stock levels stock, stock+1, ..., stock+multiplier-1
+     * Levels below 1 count as 1, like the trader's empty-stock price
+     */
+    static float GetProgressiveFactor(float coefficient, int stock, int multiplier)
+    {
+        if (multiplier <= 0)
+            return 0;
+
+        int fixedCoefficient = ToFixedCoefficient(coefficient);
+
+        // Units priced at the clamped level 1 (stock of zero or below)
+        int clampedUnits = Math.Min(multiplier, Math.Max(0, 1 - stock));
+        int progressiveUnits = multiplier - clampedUnits;
+        if (progressiveUnits == 0)
+            return clampedUnits;
+
+        int firstExponent = stock + clampedUnits - 1;
+        return clampedUnits + GetPower(fixedCoefficient, firstExponent) * GetGeometricSum(fixedCoefficient, progressiveUnits);
+    }
+
+    /**
+     * Unit factor c^(level-1) for a single stock level, levels below 1 count as 1
+     */
+    static float GetUnitFactor(float coefficient, int stockLevel)
+    {
+        if (stockLevel <= 1)
+            return 1;
+
+        return GetPower(ToFixedCoefficient(coefficient), stockLevel - 1);
+    }
+
+    // c^exponent
+    private static float GetPower(int fixedCoefficient, int exponent)
+    {
+        if (exponent >= MAX_TABLE_SIZE)
+            return Math.Pow(ToCoefficient(fixedCoefficient), exponent);
+
+        array<float> powers = s_PowersByCoefficient.Get(fixedCoefficient);
+        if (!powers)
+        {
+            powers = new array<float>();
+            powers.Insert(1.0);
+            s_PowersByCoefficient.Set(fixedCoefficient, powers);
+        }
+
+        float coefficient = ToCoefficient(fixedCoefficient);
+        while (powers.Count() <= exponent)
+        {
+            powers.Insert(powers[powers.Count() - 1] * coefficient);
+        }
+        return powers[exponent];
+    }
+
+    // 1 + c + ... + c^(count-1)
+    private static float GetGeometricSum(int fixedCoefficient, int count)
+    {
+        if (fixedCoefficient == COEFFICIENT_SCALE)
+            return count;
+
+        float coefficient = ToCoefficient(fixedCoefficient);
+        if (count >= MAX_TABLE_SIZE)
+            return (1 - Math.Pow(coefficient, count)) / (1 - coefficient);
+
+        array<float> sums = s_GeometricByCoefficient.Get(fixedCoefficient);
+        if (!sums)
+        {
+            sums = new array<float>();
+            sums.Insert(0.0);
+            s_GeometricByCoefficient.Set(fixedCoefficient, sums);
+        }
+
+        while (sums.Count() <= count)
+        {
+            int exponent = sums.Count() - 1;
+            sums.Insert(sums[exponent] + GetPower(fixedCoefficient, exponent));
+        }
+        return sums[count];
+    }
+
+    private static float ToCoefficient(int fixedCoefficient)
+    {
+        float coefficient = fixedCoefficient;
+        return coefficient / COEFFICIENT_SCALE;
+    }
+}
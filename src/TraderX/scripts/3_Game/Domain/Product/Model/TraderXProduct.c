@@ -185,13 +185,6 @@ class TraderXProduct extends TraderXJsonProduct
         return attachments.Count() > 0;
     }
 
-    void LoadCategoryStock()
-    {
-        if (maxStock == -1) return; // Skip if stock is unlimited
-        
-        TraderXProductStockRepository.LoadCategoryStock(productId, GetStockBehaviorAtRestart(), maxStock, GetDeStockCoefficient());
-    }
-
     int GetStockBehaviorAtRestart()
     {
         return (stockSettings >> 7) & 0x03;
@@ -14,12 +14,12 @@ class TraderXProductStock
         return stock;
     }
 
-    void DecreaseStock()
+    void DecreaseStock(int amount = 1)
     {
         if(stock == 0)
             return;
         
-        SetStock(stock - 1);
+        SetStock(Math.Max(stock - amount, 0));
     }
 
     void IncreaseStock(int multiplier = 1)
@@ -27,10 +27,14 @@ class TraderXProductStock
         SetStock(stock + 1*multiplier);
     }
 
+    // Persistence is write-behind: the repository flushes dirty stock on its own schedule
     void SetStock(int stock)
     {
+        if(this.stock == stock)
+            return;
+
         this.stock = stock;
-        TraderXProductStockRepository.Save(this);
+        TraderXProductStockRepository.MarkDirty(this);
     }
 }
 
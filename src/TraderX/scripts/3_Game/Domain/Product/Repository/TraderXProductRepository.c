@@ -72,96 +72,46 @@ class TraderXProductRepository
         return null;	
     }
 
-    static void LoadAllProducts()
+    /**
+     * Map one entry of the compiled products file into the repository
+     * @return false when the entry is null, has no productId or fails to map
+     */
+    static bool AddCompiledProduct(TraderXCompiledProduct jsonProduct)
     {
-        GetTraderXLogger().LogInfo("[TraderX] LoadAllProducts - Starting");
+        if (!jsonProduct)
+            return false;
         
-        // Try compiled JSON first (CSV-based system)
-        if (FileExist(TRADERX_COMPILED_PRODUCTS_FILE))
+        // Validate required fields
+        if (jsonProduct.productId.Length() == 0)
         {
-            GetTraderXLogger().LogInfo("[TraderX] Loading products from compiled config");
-            LoadFromCompiledJson();
-            return;
+            GetTraderXLogger().LogWarning("[TraderX] Skipping product with empty productId in compiled file");
+            return false;
         }
         
-        // Fallback to legacy multi-file JSON
-        GetTraderXLogger().LogWarning("[TraderX] Compiled config not found, using legacy multi-file JSON");
-        LoadFromLegacyJson();
+        TraderXProduct product = TraderXProductMapper.MapToTraderXProduct(jsonProduct);
+        if (!product)
+            return false;
+        
+        product.productId = jsonProduct.productId;
+        if (product.productId.Length() == 0)
+            return false;
+        
+        s_Items.Set(product.productId, product);
+        return true;
     }
     
-    // Load products from compiled JSON (CSV-based system)
-    private static void LoadFromCompiledJson()
+    static void ClearProducts()
     {
-        ref array<ref TraderXCompiledProduct> jsonProducts = new array<ref TraderXCompiledProduct>;
-        JsonFileLoader<array<ref TraderXCompiledProduct>>.JsonLoadFile(TRADERX_COMPILED_PRODUCTS_FILE, jsonProducts);
-        
-        if (!jsonProducts || jsonProducts.Count() == 0)
-        {
-            GetTraderXLogger().LogError("[TraderX] Failed to load compiled products (empty or null), falling back to legacy");
-            LoadFromLegacyJson();
-            return;
-        }
-        
         s_Items.Clear();
-        int successCount = 0;
-        int failCount = 0;
-        
-        foreach (TraderXCompiledProduct jsonProduct : jsonProducts)
-        {
-            if (!jsonProduct)
-            {
-                failCount++;
-                continue;
-            }
-            
-            // Validate required fields
-            if (jsonProduct.productId.Length() == 0)
-            {
-                GetTraderXLogger().LogWarning("[TraderX] Skipping product with empty productId in compiled file");
-                failCount++;
-                continue;
-            }
-            
-            TraderXProduct product = TraderXProductMapper.MapToTraderXProduct(jsonProduct);
-            if (product)
-            {
-                product.productId = jsonProduct.productId;
-                if (product.productId.Length() > 0)
-                {
-                    s_Items.Set(product.productId, product);
-                    successCount++;
-                }
-                else
-                {
-                    failCount++;
-                }
-            }
-            else
-            {
-                failCount++;
-            }
-        }
-        
-        // If too many failures, fall back to legacy
-        if (successCount == 0 && failCount > 0)
-        {
-            GetTraderXLogger().LogError(string.Format("[TraderX] All %1 products failed to load from compiled file, falling back to legacy", failCount));
-            LoadFromLegacyJson();
-            return;
-        }
-        
-        if (failCount > 0)
-        {
-            GetTraderXLogger().LogWarning(string.Format("[TraderX] Loaded %1 products from compiled file, %2 failed", successCount, failCount));
-        }
-        else
-        {
-            GetTraderXLogger().LogInfo(string.Format("[TraderX] LoadAllProducts - Completed. Total products loaded: %1 (from compiled config)", s_Items.Count()));
-        }
+    }
+    
+    static int GetProductCount()
+    {
+        return s_Items.Count();
     }
     
     // Load products from legacy multi-file JSON (backward compatibility)
-    private static void LoadFromLegacyJson()
+    static void LoadFromLegacyJson()
     {
         if (!FileExist(TRADERX_PRODUCTS_DIR)){
             MakeDirectory(TRADERX_PRODUCTS_DIR);
@@ -2,7 +2,68 @@ class TraderXProductStockRepository
 {
     static ref map<string, ref TraderXProductStock> s_itemsStockByItemId = new map<string, ref TraderXProductStock>();
 
-    static void GetStockArrForCategoriesId(array<string> categoriesId, out array<ref TraderXProductStock> stockArr)
+    // Write-behind: in-memory stock is authoritative, mutated entries wait here until the next flush
+    private static ref map<string, ref TraderXProductStock> s_DirtyStockByItemId = new map<string, ref TraderXProductStock>();
+    private static float s_FlushDeltaTime = 0;
+    private static ETraderXStockStorageMode s_StorageMode = ETraderXStockStorageMode.PER_FILE;
+
+    // Change feed: productId -> latest stock since the last broadcast, drained once per server frame
+    private static ref map<string, int> s_ChangedStockByItemId = new map<string, int>();
+
+    // Versioning: every mutation bumps the version and stamps the product with it. Starts at 1 so
+    // a snapshot always carries a version a client can send back
+    private static int s_StockVersion = 1;
+    private static ref map<string, int> s_ChangedAtVersionByItemId = new map<string, int>();
+
+    // Client: version of the last stock received per npc
+    private static ref map<int, int> s_KnownStockVersionByNpcId = new map<int, int>();
+
+    /**
+     * Server boot: select the storage mode and migrate stock if the mode changed since last run
+     * JOURNAL mode loads every stock entry up front from a single snapshot + journal
+     */
+    static void Initialize()
+    {
+        MakeDirectoryIfNotExists();
+        s_StorageMode = TraderXPerformanceSettingsRepository.GetSettings().GetStockStorageMode();
+
+        if (s_StorageMode == ETraderXStockStorageMode.JOURNAL)
+        {
+            if (TraderXStockJournalStore.HasStoredData())
+                TraderXStockJournalStore.LoadAll(s_itemsStockByItemId);
+            else
+                TraderXStockJournalStore.ImportFromPerFile(s_itemsStockByItemId);
+            return;
+        }
+
+        if (TraderXStockJournalStore.HasStoredData())
+            MigrateJournalToPerFile();
+    }
+
+    static bool IsJournalMode()
+    {
+        return s_StorageMode == ETraderXStockStorageMode.JOURNAL;
+    }
+
+    // Switching back to PER_FILE: write one file per product from the journal, then archive it
+    private static void MigrateJournalToPerFile()
+    {
+        TraderXStockJournalStore.LoadAll(s_itemsStockByItemId);
+
+        foreach (string productId, TraderXProductStock itemStock : s_itemsStockByItemId)
+        {
+            Save(itemStock);
+        }
+        TraderXStockJournalStore.Archive();
+
+        GetTraderXLogger().LogInfo(string.Format("[STOCK] Migrated %1 stock entries from the journal store to per-file storage", s_itemsStockByItemId.Count()));
+    }
+
+    /**
+     * Collect the stock of every product in the given categories
+     * @param changedSinceVersion only keep products changed after this version, 0 keeps everything
+     */
+    static void GetStockArrForCategoriesId(array<string> categoriesId, out array<ref TraderXProductStock> stockArr, int changedSinceVersion = 0)
     {
         // Pre-load all stock for categories to avoid N+1 file I/O problem
         LoadStockForCategories(categoriesId);
@@ -23,7 +84,7 @@ class TraderXProductStockRepository
                 
                 // Stock should already be loaded by LoadStockForCategories
                 TraderXProductStock stock = s_itemsStockByItemId[tpItem.productId];
-                if (stock) {
+                if (stock && HasChangedSince(tpItem.productId, changedSinceVersion)) {
                     stockArr.Insert(stock);
                 }
             }
@@ -40,6 +101,7 @@ class TraderXProductStockRepository
             
             // Store in client-side cache (same pattern as server)
             s_itemsStockByItemId.Set(itemStock.productId, itemStock);
+            s_StockVersion++;
             GetTraderXLogger().LogDebug("RefStockToTraderXProduct: Cached stock for " + itemStock.productId + " (stock: " + itemStock.GetStock() + ")");
         }
     }
@@ -113,6 +175,12 @@ class TraderXProductStockRepository
         
         foreach(string productId: productIds)
         {
+            // Journal mode loaded everything at boot, anything missing is a new product
+            if (IsJournalMode()) {
+                CreateDefaultStock(productId);
+                continue;
+            }
+            
             string filePath = string.Format(TRADERX_STOCK_FILE, productId);
             TraderXProductStock itemStock = new TraderXProductStock(productId, 0);
             
@@ -127,52 +195,97 @@ class TraderXProductStockRepository
             } else {
                 // Create new stock file for products that don't have one
                 s_itemsStockByItemId.Set(productId, itemStock);
-                Save(itemStock);
+                MarkDirty(itemStock);
             }
         }
     }
 
-    static void SetStockMax(string productId, int maxStock)
+    /**
+     * Stock a product starts the session with
+     * @param stockBehavior 1 refills to maxStock, 2 picks a random level, anything else keeps the stock.
+     *        The destock coefficient then removes its share of what is left.
+     */
+    static int ComputeRestartStock(int currentStock, int stockBehavior, int maxStock, float deStockCoefficient)
     {
-        TraderXProductStock stock = GetStockByProductId(productId);
-        if (stock) {
-            stock.SetStock(maxStock);
-            Save(stock);
+        int newStock = currentStock;
+        if (stockBehavior == 1) {
+            newStock = maxStock;
+        } else if (stockBehavior == 2) {
+            newStock = Math.RandomIntInclusive(0, maxStock);
+        }
+        
+        if (deStockCoefficient > 0) {
+            newStock = Math.Round(newStock * (1.0 - deStockCoefficient));
         }
+        
+        return newStock;
     }
     
-    static void SetRandomStock(string productId, int maxStock)
+    /**
+     * Server boot: apply the restart behavior of the limited products in [start, end)
+     * New values are only computed in memory, CommitRestartBehaviors persists the whole sweep once
+     * every slice has run, so the startup can spread a large catalog over several frames.
+     * @param changedStock receives productId -> new stock for every product whose stock changed
+     */
+    static void ApplyRestartBehaviorsRange(array<ref TraderXProduct> products, int start, int end, map<string, int> changedStock)
     {
-        TraderXProductStock stock = GetStockByProductId(productId);
-        if (stock) {
-            stock.SetStock(Math.RandomIntInclusive(0, maxStock));
-            Save(stock);
+        array<string> productIdsToLoad = new array<string>();
+        for (int i = start; i < end; i++)
+        {
+            TraderXProduct product = products[i];
+            if (product && !product.IsStockUnlimited() && !s_itemsStockByItemId.Contains(product.productId))
+                productIdsToLoad.Insert(product.productId);
+        }
+        LoadStockBulk(productIdsToLoad);
+        
+        for (int j = start; j < end; j++)
+        {
+            TraderXProduct restartProduct = products[j];
+            if (!restartProduct || restartProduct.IsStockUnlimited())
+                continue;
+            
+            TraderXProductStock itemStock = s_itemsStockByItemId.Get(restartProduct.productId);
+            if (!itemStock)
+                continue;
+            
+            int newStock = ComputeRestartStock(itemStock.stock, restartProduct.GetStockBehaviorAtRestart(), restartProduct.maxStock, restartProduct.GetDeStockCoefficient());
+            if (newStock == itemStock.stock)
+                continue;
+            
+            itemStock.stock = newStock;
+            changedStock.Set(itemStock.productId, newStock);
+            s_DirtyStockByItemId.Set(itemStock.productId, itemStock);
         }
     }
     
-    static void DeStock(string productId, float deStockCoefficient)
+    /**
+     * Persist a finished restart sweep: one snapshot in JOURNAL mode, one flush of the changed
+     * files in PER_FILE mode. The whole pass shares a single stock version and stays out of the
+     * change feed, no trader session is open yet.
+     */
+    static void CommitRestartBehaviors(map<string, int> changedStock)
     {
-        if (deStockCoefficient <= 0) return;
+        // Stock files created by LoadStockBulk do not need a broadcast either
+        s_ChangedStockByItemId.Clear();
         
-        TraderXProductStock stock = GetStockByProductId(productId);
-        if (!stock) return;
+        if (changedStock.Count() == 0)
+            return;
         
-        int currentStock = stock.GetStock();
-        int newStock = Math.Round(currentStock * (1.0 - deStockCoefficient));
-        stock.SetStock(newStock);
-        Save(stock);
-    }
-    
-    static void LoadCategoryStock(string productId, int stockBehavior, int maxStock, float deStockCoefficient)
-    {
-        if (stockBehavior == 1) {
-            SetStockMax(productId, maxStock);
-        } else if (stockBehavior == 2) {
-            SetRandomStock(productId, maxStock);
+        s_StockVersion++;
+        foreach (string changedProductId, int _ : changedStock)
+        {
+            s_ChangedAtVersionByItemId.Set(changedProductId, s_StockVersion);
         }
         
-        if (deStockCoefficient > 0) {
-            DeStock(productId, deStockCoefficient);
+        if (IsJournalMode())
+        {
+            // The snapshot holds every entry, nothing is left to append to the journal
+            if (TraderXStockJournalStore.Compact(s_itemsStockByItemId))
+                s_DirtyStockByItemId.Clear();
+        }
+        else
+        {
+            Flush();
         }
     }
 
@@ -237,10 +350,7 @@ class TraderXProductStockRepository
             return false;
         }
         
-        for (int i = 0; i < amount; i++) {
-            stock.DecreaseStock();
-        }
-        Save(stock);
+        stock.DecreaseStock(amount);
         return true;
     }
     
@@ -252,7 +362,6 @@ class TraderXProductStockRepository
         }
         
         stock.IncreaseStock(amount);
-        Save(stock);
         return true;
     }
 
@@ -265,6 +374,10 @@ class TraderXProductStockRepository
             return s_itemsStockByItemId[id];
         }
         
+        if (IsJournalMode()) {
+            return CreateDefaultStock(id);
+        }
+        
         string filePath = string.Format(TRADERX_STOCK_FILE, id);
         TraderXProductStock itemStock = new TraderXProductStock(id, 0);
 
@@ -285,10 +398,18 @@ class TraderXProductStockRepository
 
         GetTraderXLogger().LogDebug("Stock file " + filePath + " doesn't exist, creating new stock");
         s_itemsStockByItemId.Set(id, itemStock);
-        Save(itemStock);
+        MarkDirty(itemStock);
 		return itemStock;
     }
 
+    private static TraderXProductStock CreateDefaultStock(string productId)
+    {
+        TraderXProductStock itemStock = new TraderXProductStock(productId, 0);
+        s_itemsStockByItemId.Set(productId, itemStock);
+        MarkDirty(itemStock);
+        return itemStock;
+    }
+
     static void Save(TraderXProductStock itemStock)
     {
         string filePath = string.Format(TRADERX_STOCK_FILE, itemStock.productId);
@@ -297,4 +418,130 @@ class TraderXProductStockRepository
             GetTraderXLogger().LogError("Failed to save stock file: " + filePath + " - " + errorMessage);
         }
     }
+
+    static void MarkDirty(TraderXProductStock itemStock)
+    {
+        if (!itemStock || !GetGame().IsServer())
+            return;
+
+        s_DirtyStockByItemId.Set(itemStock.productId, itemStock);
+        s_ChangedStockByItemId.Set(itemStock.productId, itemStock.GetStock());
+
+        s_StockVersion++;
+        s_ChangedAtVersionByItemId.Set(itemStock.productId, s_StockVersion);
+    }
+
+    static int GetStockVersion()
+    {
+        return s_StockVersion;
+    }
+
+    static bool HasChangedSince(string productId, int version)
+    {
+        if (version <= 0)
+            return true;
+
+        int changedAtVersion;
+        if (!s_ChangedAtVersionByItemId.Find(productId, changedAtVersion))
+            return false;
+
+        return changedAtVersion > version;
+    }
+
+    // Client: 0 means no snapshot was received for this npc yet
+    static int GetKnownStockVersion(int npcId)
+    {
+        return s_KnownStockVersionByNpcId.Get(npcId);
+    }
+
+    static void SetKnownStockVersion(int npcId, int version)
+    {
+        s_KnownStockVersionByNpcId.Set(npcId, version);
+    }
+
+    // Client: versions restart with every server run, a new join must start from full snapshots
+    static void ClearKnownStockVersions()
+    {
+        s_KnownStockVersionByNpcId.Clear();
+    }
+
+    static bool HasStockChanges()
+    {
+        return s_ChangedStockByItemId.Count() > 0;
+    }
+
+    /**
+     * Hand over the stock changes accumulated since the last call, several changes to the
+     * same product within the window collapse into its latest value
+     */
+    static map<string, int> TakeStockChanges()
+    {
+        map<string, int> changes = s_ChangedStockByItemId;
+        s_ChangedStockByItemId = new map<string, int>();
+        return changes;
+    }
+
+    // Client: apply one entry of a stock delta
+    static void ApplyStockDelta(string productId, int stock)
+    {
+        // Client versions are local, they only tell stock-derived caches to refresh
+        s_StockVersion++;
+
+        TraderXProductStock itemStock = s_itemsStockByItemId.Get(productId);
+        if (itemStock)
+            itemStock.stock = stock;
+        else
+            s_itemsStockByItemId.Set(productId, new TraderXProductStock(productId, stock));
+    }
+
+    static int GetDirtyCount()
+    {
+        return s_DirtyStockByItemId.Count();
+    }
+
+    // @return true when a flush ran this frame
+    static bool FlushIfDue(float deltaTime)
+    {
+        s_FlushDeltaTime += deltaTime;
+        if (s_FlushDeltaTime < TraderXPerformanceSettingsRepository.GetSettings().stockFlushIntervalSeconds)
+            return false;
+
+        s_FlushDeltaTime = 0;
+        Flush();
+        return true;
+    }
+
+    // Persist every stock entry mutated since the last flush
+    static void Flush()
+    {
+        if (s_DirtyStockByItemId.Count() == 0)
+            return;
+
+        MakeDirectoryIfNotExists();
+
+        int flushedCount = s_DirtyStockByItemId.Count();
+        if (IsJournalMode())
+        {
+            TraderXStockJournalStore.Append(s_DirtyStockByItemId, s_itemsStockByItemId);
+        }
+        else
+        {
+            foreach (string productId, TraderXProductStock itemStock : s_DirtyStockByItemId)
+            {
+                Save(itemStock);
+            }
+        }
+        s_DirtyStockByItemId.Clear();
+
+        GetTraderXLogger().LogDebug("Flush: persisted " + flushedCount + " stock entries");
+    }
+
+    // Mission finish: persist pending changes and leave a compact snapshot for the next boot
+    static void Shutdown()
+    {
+        Flush();
+
+        if (IsJournalMode() && TraderXStockJournalStore.GetJournalEntryCount() > 0)
+            TraderXStockJournalStore.Compact(s_itemsStockByItemId);
+    }
 }
@@ -0,0 +1,297 @@
+/**
+ * TraderXStockJournalStore - Single-file stock storage: one snapshot plus an append-only journal
+ * Each flush appends "productId;stock" lines to the journal, boot loads the snapshot and replays
+ * the journal on top of it. Lines carry absolute values, so replaying a journal that was already
+ * folded into the snapshot is harmless. The journal is compacted into a new snapshot once it
+ * grows past stockJournalCompactThreshold lines and at mission finish.
+ */
+class TraderXStockJournalStore
+{
+    private static const string END_MARKER = "#END";
+    private static const string SEPARATOR = ";";
+    private static const string NUMBER_CHARS = "-0123456789";
+
+    private static int s_JournalEntryCount = 0;
+
+    static bool HasSnapshot()
+    {
+        return FileExist(TRADERX_STOCK_SNAPSHOT_FILE) || FileExist(TRADERX_STOCK_SNAPSHOT_TMP_FILE);
+    }
+
+    static bool HasStoredData()
+    {
+        return HasSnapshot() || FileExist(TRADERX_STOCK_JOURNAL_FILE);
+    }
+
+    static int GetJournalEntryCount()
+    {
+        return s_JournalEntryCount;
+    }
+
+    /**
+     * Load the snapshot then replay the journal into stockByItemId
+     * @return number of products loaded
+     */
+    static int LoadAll(map<string, ref TraderXProductStock> stockByItemId)
+    {
+        if (!ReadSnapshot(TRADERX_STOCK_SNAPSHOT_FILE, stockByItemId))
+        {
+            // A crash during compaction leaves the complete snapshot in the temp file
+            if (ReadSnapshot(TRADERX_STOCK_SNAPSHOT_TMP_FILE, stockByItemId))
+            {
+                GetTraderXLogger().LogWarning("[STOCK JOURNAL] Snapshot incomplete, recovered from " + TRADERX_STOCK_SNAPSHOT_TMP_FILE);
+            }
+            else if (HasSnapshot())
+            {
+                GetTraderXLogger().LogError("[STOCK JOURNAL] No complete snapshot found, rebuilding stock from journal only");
+            }
+        }
+
+        s_JournalEntryCount = ReplayJournal(stockByItemId);
+
+        GetTraderXLogger().LogInfo(string.Format("[STOCK JOURNAL] Loaded %1 products, replayed %2 journal entries", stockByItemId.Count(), s_JournalEntryCount));
+        return stockByItemId.Count();
+    }
+
+    /**
+     * Append the given entries to the journal in a single file open
+     * Compacts when the journal exceeds the configured threshold
+     */
+    static void Append(map<string, ref TraderXProductStock> dirtyStock, map<string, ref TraderXProductStock> allStock)
+    {
+        if (dirtyStock.Count() == 0)
+            return;
+
+        FileHandle fh = OpenFile(TRADERX_STOCK_JOURNAL_FILE, FileMode.APPEND);
+        if (!fh)
+        {
+            GetTraderXLogger().LogError("[STOCK JOURNAL] Could not open journal " + TRADERX_STOCK_JOURNAL_FILE);
+            return;
+        }
+
+        foreach (string productId, TraderXProductStock itemStock : dirtyStock)
+        {
+            FPrintln(fh, productId + SEPARATOR + itemStock.GetStock());
+        }
+        CloseFile(fh);
+
+        s_JournalEntryCount += dirtyStock.Count();
+
+        if (s_JournalEntryCount >= TraderXPerformanceSettingsRepository.GetSettings().stockJournalCompactThreshold)
+            Compact(allStock);
+    }
+
+    /**
+     * Fold the whole in-memory stock into a fresh snapshot and truncate the journal
+     * The snapshot is written to a temp file first so a crash never leaves us without a complete one
+     */
+    static bool Compact(map<string, ref TraderXProductStock> allStock)
+    {
+        if (!WriteSnapshot(TRADERX_STOCK_SNAPSHOT_TMP_FILE, allStock))
+            return false;
+
+        if (FileExist(TRADERX_STOCK_SNAPSHOT_FILE))
+            DeleteFile(TRADERX_STOCK_SNAPSHOT_FILE);
+
+        if (!CopyFile(TRADERX_STOCK_SNAPSHOT_TMP_FILE, TRADERX_STOCK_SNAPSHOT_FILE))
+        {
+            GetTraderXLogger().LogError("[STOCK JOURNAL] Could not promote snapshot, keeping " + TRADERX_STOCK_SNAPSHOT_TMP_FILE);
+            return false;
+        }
+
+        // Truncate the journal, everything it held is now in the snapshot
+        FileHandle fh = OpenFile(TRADERX_STOCK_JOURNAL_FILE, FileMode.WRITE);
+        if (fh)
+            CloseFile(fh);
+
+        DeleteFile(TRADERX_STOCK_SNAPSHOT_TMP_FILE);
+
+        GetTraderXLogger().LogInfo(string.Format("[STOCK JOURNAL] Compacted %1 journal entries into a snapshot of %2 products", s_JournalEntryCount, allStock.Count()));
+        s_JournalEntryCount = 0;
+        return true;
+    }
+
+    /**
+     * Migration: per-file layout -> journal
+     * Reads every Stock/<productId>.json and writes them as the first snapshot, the per-file
+     * directory is left untouched so switching back stays possible
+     */
+    static int ImportFromPerFile(map<string, ref TraderXProductStock> stockByItemId)
+    {
+        string filename;
+        FileAttr attr;
+        int imported = 0;
+
+        FindFileHandle findHandle = FindFile(TRADERX_STOCK_DIR + "*.json", filename, attr, FindFileFlags.ALL);
+        if (findHandle == 0)
+        {
+            // Fresh install: start from an empty snapshot so the next boot takes the journal path
+            Compact(stockByItemId);
+            return 0;
+        }
+
+        bool hasFile = true;
+        while (hasFile)
+        {
+            string productId = filename;
+            productId.Replace(".json", "");
+
+            TraderXProductStock itemStock = new TraderXProductStock(productId, 0);
+            string errorMessage;
+            if (JsonFileLoader<TraderXProductStock>.LoadFile(TRADERX_STOCK_DIR + filename, itemStock, errorMessage))
+            {
+                stockByItemId.Set(productId, itemStock);
+                imported++;
+            }
+            else
+            {
+                GetTraderXLogger().LogError("[STOCK JOURNAL] Import skipped " + filename + " - " + errorMessage);
+            }
+
+            hasFile = FindNextFile(findHandle, filename, attr);
+        }
+        CloseFindFile(findHandle);
+
+        Compact(stockByItemId);
+        GetTraderXLogger().LogInfo(string.Format("[STOCK JOURNAL] Migrated %1 per-file stock entries to the journal store", imported));
+        return imported;
+    }
+
+    /**
+     * Migration: journal -> per-file layout
+     * The caller writes the per-file entries, the journal files are then archived out of the way
+     */
+    static void Archive()
+    {
+        ArchiveFile(TRADERX_STOCK_SNAPSHOT_FILE);
+        ArchiveFile(TRADERX_STOCK_JOURNAL_FILE);
+
+        if (FileExist(TRADERX_STOCK_SNAPSHOT_TMP_FILE))
+            DeleteFile(TRADERX_STOCK_SNAPSHOT_TMP_FILE);
+
+        s_JournalEntryCount = 0;
+    }
+
+    private static void ArchiveFile(string path)
+    {
+        if (!FileExist(path))
+            return;
+
+        string archivePath = path + ".migrated";
+        if (FileExist(archivePath))
+            DeleteFile(archivePath);
+
+        CopyFile(path, archivePath);
+        DeleteFile(path);
+    }
+
+    private static bool WriteSnapshot(string path, map<string, ref TraderXProductStock> allStock)
+    {
+        FileHandle fh = OpenFile(path, FileMode.WRITE);
+        if (!fh)
+        {
+            GetTraderXLogger().LogError("[STOCK JOURNAL] Could not write snapshot " + path);
+            return false;
+        }
+
+        foreach (string productId, TraderXProductStock itemStock : allStock)
+        {
+            FPrintln(fh, productId + SEPARATOR + itemStock.GetStock());
+        }
+
+        // The end marker is what makes a snapshot complete
+        FPrintln(fh, END_MARKER + SEPARATOR + allStock.Count());
+        CloseFile(fh);
+        return true;
+    }
+
+    // Entries are only committed when the end marker is present and the count matches
+    private static bool ReadSnapshot(string path, map<string, ref TraderXProductStock> stockByItemId)
+    {
+        if (!FileExist(path))
+            return false;
+
+        FileHandle fh = OpenFile(path, FileMode.READ);
+        if (!fh)
+            return false;
+
+        map<string, int> entries = new map<string, int>();
+        bool complete = false;
+        string line;
+        string key;
+        int value;
+
+        while (FGets(fh, line) >= 0)
+        {
+            if (!ParseLine(line, key, value))
+                continue;
+
+            if (key == END_MARKER)
+            {
+                complete = (value == entries.Count());
+                break;
+            }
+
+            entries.Set(key, value);
+        }
+        CloseFile(fh);
+
+        if (!complete)
+            return false;
+
+        foreach (string productId, int stock : entries)
+        {
+            stockByItemId.Set(productId, new TraderXProductStock(productId, stock));
+        }
+        return true;
+    }
+
+    private static int ReplayJournal(map<string, ref TraderXProductStock> stockByItemId)
+    {
+        if (!FileExist(TRADERX_STOCK_JOURNAL_FILE))
+            return 0;
+
+        FileHandle fh = OpenFile(TRADERX_STOCK_JOURNAL_FILE, FileMode.READ);
+        if (!fh)
+            return 0;
+
+        int replayed = 0;
+        string line;
+        string productId;
+        int stock;
+
+        while (FGets(fh, line) >= 0)
+        {
+            // A torn last line from a crash mid-append simply fails to parse
+            if (!ParseLine(line, productId, stock))
+                continue;
+
+            TraderXProductStock itemStock = stockByItemId.Get(productId);
+            if (itemStock)
+                itemStock.stock = stock;
+            else
+                stockByItemId.Set(productId, new TraderXProductStock(productId, stock));
+
+            replayed++;
+        }
+        CloseFile(fh);
+
+        return replayed;
+    }
+
+    private static bool ParseLine(string line, out string key, out int value)
+    {
+        line.TrimInPlace();
+        int separatorIndex = line.IndexOf(SEPARATOR);
+        if (separatorIndex <= 0 || separatorIndex == line.Length() - 1)
+            return false;
+
+        key = line.Substring(0, separatorIndex);
+        string valueStr = line.Substring(separatorIndex + 1, line.Length() - separatorIndex - 1);
+        if (NUMBER_CHARS.IndexOf(valueStr.Get(0)) == -1)
+            return false;
+
+        value = valueStr.ToInt();
+        return true;
+    }
+}
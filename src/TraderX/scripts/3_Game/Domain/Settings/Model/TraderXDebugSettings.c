@@ -15,8 +15,20 @@ class TraderXDebugSettings
     bool runTransactionServiceTests = true;
     bool runVehicleTransactionTests = false;
     bool runPricingServiceTests = true;
+    bool runClassMetadataTests = true;
     bool runJSONTestCases = true;
     
+    // Load test: dummy players driving random trades through the transaction scheduler
+    bool runLoadTest = false;
+    int loadTestPlayers = 20;
+    float loadTestRequestsPerSecond = 20.0;
+    int loadTestDurationSeconds = 120;
+    int loadTestMaxBatchSize = 4;
+    float loadTestSellRatio = 0.3;
+    float loadTestPresetRatio = 0.1;
+    int loadTestWalletAmount = 100000;
+    ref array<string> loadTestLoadout = {"TacticalShirt_Grey", "HighCapacityVest_Black", "HunterPants_Winter", "AthleticShoes_Blue", "HuntingBag"};
+    
     // Admin Control Settings
     ref array<string> authorizedAdmins = new array<string>();
     
@@ -36,6 +48,7 @@ class TraderXDebugSettings
         runTransactionServiceTests = true;
         runVehicleTransactionTests = false;
         runPricingServiceTests = true;
+        runClassMetadataTests = true;
         runJSONTestCases = true;
         
         // Initialize with empty admin list - add Steam64 IDs as needed
@@ -48,7 +61,17 @@ class TraderXDebugSettings
      */
     void ValidateSettings()
     {
-        // No validation needed for current properties
+        if (loadTestPlayers < 1)
+            loadTestPlayers = 1;
+        
+        if (loadTestRequestsPerSecond <= 0)
+            loadTestRequestsPerSecond = 1;
+        
+        if (loadTestMaxBatchSize < 1)
+            loadTestMaxBatchSize = 1;
+        
+        loadTestSellRatio = Math.Clamp(loadTestSellRatio, 0, 1);
+        loadTestPresetRatio = Math.Clamp(loadTestPresetRatio, 0, 1);
     }
     
     /**
@@ -56,7 +79,7 @@ class TraderXDebugSettings
      */
     bool ShouldRunAnyTests()
     {
-        return runCurrencyServiceTests || runTransactionServiceTests || runVehicleTransactionTests || runPricingServiceTests || runJSONTestCases;
+        return runCurrencyServiceTests || runTransactionServiceTests || runVehicleTransactionTests || runPricingServiceTests || runClassMetadataTests || runJSONTestCases;
     }
     
     /**
@@ -139,6 +162,11 @@ class TraderXDebugSettings
         else
             summary += string.Format("    - Pricing Service: NO\n");
         
+        if (runClassMetadataTests)
+            summary += string.Format("    - Class Metadata: YES\n");
+        else
+            summary += string.Format("    - Class Metadata: NO\n");
+        
         if (runVehicleTransactionTests)
             summary += string.Format("    - Vehicle Transactions: YES\n");
         else
@@ -149,6 +177,9 @@ class TraderXDebugSettings
         else
             summary += string.Format("    - JSON Test Cases: NO\n");
         
+        if (runLoadTest)
+            summary += string.Format("  Load Test: %1 players, %2 req/s for %3 s\n", loadTestPlayers, loadTestRequestsPerSecond, loadTestDurationSeconds);
+        
         if(authorizedAdmins && authorizedAdmins.Count() > 0)
         {
             summary += string.Format("  Authorized Admins: %1\n", authorizedAdmins.Count().ToString());
@@ -0,0 +1,101 @@
+/**
+ * TraderXPerformanceSettings - Server-side tuning knobs for the trading engine
+ * Controls how much work TraderX is allowed to do per server frame
+ */
+// Where product stock is persisted
+enum ETraderXStockStorageMode
+{
+    PER_FILE,   // One Stock/<productId>.json file per product
+    JOURNAL     // Single snapshot file plus an append-only journal
+};
+
+class TraderXPerformanceSettings
+{
+    string version = TRADERX_CURRENT_VERSION;
+
+    // Transaction scheduler
+    float transactionQueueIntervalSeconds = 0.1;
+    float transactionTimeBudgetMs = 4.0;
+    int transactionStatsLogIntervalSeconds = 300;
+    int maxQueuedRequests = 512;
+    int maxQueuedRequestsPerPlayer = 8;
+
+    // Stock persistence
+    float stockFlushIntervalSeconds = 30.0;
+    string stockStorageMode = "PER_FILE";   // "PER_FILE" or "JOURNAL"
+    int stockJournalCompactThreshold = 5000;
+
+    // Transaction pipeline metrics dump, 0 disables it
+    int metricsDumpIntervalSeconds = 60;
+
+    // Server startup, work done per frame before yielding to the game
+    float initFrameBudgetMs = 8.0;
+
+    void TraderXPerformanceSettings()
+    {
+        // Constructor - default values already set above
+    }
+
+    /**
+     * Validate settings and apply constraints
+     */
+    void ValidateSettings()
+    {
+        if (transactionQueueIntervalSeconds < 0)
+            transactionQueueIntervalSeconds = 0;
+
+        // A budget of zero would stall the queue, at least one request is always processed per tick
+        if (transactionTimeBudgetMs < 0.5)
+            transactionTimeBudgetMs = 0.5;
+
+        if (transactionStatsLogIntervalSeconds < 0)
+            transactionStatsLogIntervalSeconds = 0;
+
+        if (maxQueuedRequests < 1)
+            maxQueuedRequests = 1;
+
+        if (maxQueuedRequestsPerPlayer < 1)
+            maxQueuedRequestsPerPlayer = 1;
+
+        if (stockFlushIntervalSeconds < 1)
+            stockFlushIntervalSeconds = 1;
+
+        if (stockJournalCompactThreshold < 100)
+            stockJournalCompactThreshold = 100;
+
+        if (metricsDumpIntervalSeconds < 0)
+            metricsDumpIntervalSeconds = 0;
+
+        // Same as the transaction budget, one startup step always runs per frame
+        if (initFrameBudgetMs < 1)
+            initFrameBudgetMs = 1;
+    }
+
+    ETraderXStockStorageMode GetStockStorageMode()
+    {
+        string upperMode = stockStorageMode;
+        upperMode.ToUpper();
+
+        if (upperMode == "JOURNAL")
+            return ETraderXStockStorageMode.JOURNAL;
+
+        return ETraderXStockStorageMode.PER_FILE;
+    }
+
+    /**
+     * Get formatted settings summary for logging
+     */
+    string GetSettingsSummary()
+    {
+        string summary = "[PERFORMANCE SETTINGS]\n";
+        summary += string.Format("  Transaction queue interval: %1 s\n", transactionQueueIntervalSeconds);
+        summary += string.Format("  Transaction time budget: %1 ms\n", transactionTimeBudgetMs);
+        summary += string.Format("  Transaction stats log interval: %1 s\n", transactionStatsLogIntervalSeconds);
+        summary += string.Format("  Max queued requests: %1 (per player: %2)\n", maxQueuedRequests, maxQueuedRequestsPerPlayer);
+        summary += string.Format("  Stock flush interval: %1 s\n", stockFlushIntervalSeconds);
+        summary += string.Format("  Stock storage mode: %1 (journal compaction at %2 entries)\n", stockStorageMode, stockJournalCompactThreshold);
+        summary += string.Format("  Metrics dump interval: %1 s\n", metricsDumpIntervalSeconds);
+        summary += string.Format("  Startup frame budget: %1 ms\n", initFrameBudgetMs);
+        return summary;
+    }
+}
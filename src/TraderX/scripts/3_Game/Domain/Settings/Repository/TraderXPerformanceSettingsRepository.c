@@ -0,0 +1,64 @@
+/**
+ * TraderXPerformanceSettingsRepository - Handles persistence of performance settings
+ * Settings are loaded once and cached, call Reload() to pick up manual edits
+ */
+class TraderXPerformanceSettingsRepository
+{
+    private static ref TraderXPerformanceSettings s_Settings;
+
+    static TraderXPerformanceSettings GetSettings()
+    {
+        if (!s_Settings) {
+            s_Settings = Load();
+        }
+        return s_Settings;
+    }
+
+    static TraderXPerformanceSettings Reload()
+    {
+        s_Settings = Load();
+        return s_Settings;
+    }
+
+    static void Save(TraderXPerformanceSettings settings)
+    {
+        settings.ValidateSettings();
+        JsonFileLoader<TraderXPerformanceSettings>.JsonSaveFile(TRADERX_PERFORMANCE_SETTINGS_FILE, settings);
+        s_Settings = settings;
+    }
+
+    static TraderXPerformanceSettings Load()
+    {
+        TraderXPerformanceSettings settings = new TraderXPerformanceSettings();
+
+        MakeDirectoriesIfNotExist();
+
+        if (FileExist(TRADERX_PERFORMANCE_SETTINGS_FILE)) {
+            JsonFileLoader<TraderXPerformanceSettings>.JsonLoadFile(TRADERX_PERFORMANCE_SETTINGS_FILE, settings);
+            settings.ValidateSettings();
+            CheckVersion(settings);
+        } else {
+            // Create default config file
+            Save(settings);
+        }
+
+        return settings;
+    }
+
+    static void CheckVersion(TraderXPerformanceSettings settings)
+    {
+        if (settings.version != TRADERX_CURRENT_VERSION) {
+            settings.version = TRADERX_CURRENT_VERSION;
+            Save(settings);
+        }
+    }
+
+    static void MakeDirectoriesIfNotExist()
+    {
+        if (!FileExist(TRADERX_CONFIG_ROOT_SERVER))
+            MakeDirectory(TRADERX_CONFIG_ROOT_SERVER);
+
+        if (!FileExist(TRADERX_CONFIG_DIR_SERVER))
+            MakeDirectory(TRADERX_CONFIG_DIR_SERVER);
+    }
+}
@@ -60,8 +60,8 @@
  * 
  *    CASE "LEGACY":
  *      └─ Load individual JSON files directly
- *         └─ TraderXProductRepository.LoadAllProducts()
- *         └─ TraderXCategoryRepository.LoadAllCategories()
+ *         └─ TraderXCatalogLoadCursor (compiled JSON when present,
+ *            else TraderXProductRepository/TraderXCategoryRepository.LoadFromLegacyJson())
  * 
  *    CASE "CSV":
  *      ├─ IF no Source files AND autoMigrate=true:
@@ -143,10 +143,11 @@
  * 
  * - TraderXSourceConfig: User's format preferences
  * - TraderXSourceConfigLoader: Loads/saves SourceConfig.json
- * - TraderXModule.InitializeModule(): Routes to correct loader based on format
- * - LoadLegacyConfiguration(): Handles LEGACY format
- * - LoadCsvConfiguration(): Handles CSV format  
- * - LoadCompiledConfiguration(): Handles COMPILED format
+ * - TraderXConfigurationService.PrepareConfiguration(): Migrates/compiles for the selected format
+ * - PrepareCsvConfiguration(): Handles CSV format
+ * - PrepareCompiledConfiguration(): Handles COMPILED format
+ * - PrepareBinaryConfiguration(): Handles BINARY format
+ * - TraderXCatalogLoadCursor: Maps the loaded catalog into the repositories a slice per frame
  * - TraderXConfigCompiler: CSV -> Compiled conversion
  * - TraderXJsonToCsvConverter: Legacy -> CSV conversion
  * 
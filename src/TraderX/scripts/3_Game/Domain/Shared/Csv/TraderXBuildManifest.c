@@ -0,0 +1,203 @@
+// TraderX Build Manifest - Fingerprints of the inputs and outputs of the last successful compilation
+// Every file in Source/, the source config and the compiled output are recorded with their size and
+// content hash, along with the compiler version. The binary catalog is hashed from its raw bytes.
+// When a fresh capture matches the saved manifest, the compiled files are already up to date and the
+// compilation can be skipped.
+
+class TraderXBuildManifestEntry
+{
+    string fileName;
+    int size;
+    int hash;
+
+    void TraderXBuildManifestEntry(string fileName = "", int size = 0, int hash = 0)
+    {
+        this.fileName = fileName;
+        this.size = size;
+        this.hash = hash;
+    }
+
+    bool Equals(TraderXBuildManifestEntry other)
+    {
+        return other && fileName == other.fileName && size == other.size && hash == other.hash;
+    }
+}
+
+class TraderXBuildManifest
+{
+    // Bump whenever the compiler output changes for the same sources
+    static const string COMPILER_VERSION = "2.2";
+    private static const int BINARY_BLOCK_WORDS = 256;
+
+    string compilerVersion;
+    ref array<ref TraderXBuildManifestEntry> sources;
+    ref array<ref TraderXBuildManifestEntry> outputs;
+
+    void TraderXBuildManifest()
+    {
+        compilerVersion = COMPILER_VERSION;
+        sources = new array<ref TraderXBuildManifestEntry>();
+        outputs = new array<ref TraderXBuildManifestEntry>();
+    }
+
+    // Fingerprint the current source and compiled files
+    static TraderXBuildManifest Capture()
+    {
+        TraderXBuildManifest manifest = new TraderXBuildManifest();
+
+        TStringArray sourceFiles = new TStringArray();
+        CollectFiles(TRADERX_CSV_SOURCE_DIR, "*.csv", sourceFiles);
+        CollectFiles(TRADERX_CSV_SOURCE_DIR, "*.json", sourceFiles);
+        sourceFiles.Sort();
+
+        foreach (string sourceFile : sourceFiles)
+        {
+            manifest.sources.Insert(Fingerprint(TRADERX_CSV_SOURCE_DIR + sourceFile, sourceFile));
+        }
+        manifest.sources.Insert(Fingerprint(TraderXSourceConfigLoader.GetConfigPath(), "SourceConfig.json"));
+
+        manifest.outputs.Insert(Fingerprint(TRADERX_COMPILED_PRODUCTS_FILE, "Products_compiled.json"));
+        manifest.outputs.Insert(Fingerprint(TRADERX_COMPILED_CATEGORIES_FILE, "Categories_compiled.json"));
+        manifest.outputs.Insert(FingerprintCatalogBinary());
+        return manifest;
+    }
+
+    // Null when there is no manifest yet or it cannot be read
+    static TraderXBuildManifest Load()
+    {
+        if (!FileExist(TRADERX_BUILD_MANIFEST_FILE))
+            return null;
+
+        TraderXBuildManifest manifest = new TraderXBuildManifest();
+        string errorMessage;
+        if (!JsonFileLoader<TraderXBuildManifest>.LoadFile(TRADERX_BUILD_MANIFEST_FILE, manifest, errorMessage))
+        {
+            GetTraderXLogger().LogWarning("[TraderX] Build manifest unreadable, recompiling: " + errorMessage);
+            return null;
+        }
+        return manifest;
+    }
+
+    void Save()
+    {
+        string errorMessage;
+        if (!JsonFileLoader<TraderXBuildManifest>.SaveFile(TRADERX_BUILD_MANIFEST_FILE, this, errorMessage))
+            GetTraderXLogger().LogError("[TraderX] Failed to save build manifest: " + errorMessage);
+    }
+
+    static void Delete()
+    {
+        if (FileExist(TRADERX_BUILD_MANIFEST_FILE))
+            DeleteFile(TRADERX_BUILD_MANIFEST_FILE);
+    }
+
+    // True when this capture describes the same inputs and outputs as the saved manifest
+    bool Matches(TraderXBuildManifest saved)
+    {
+        if (!saved || saved.compilerVersion != compilerVersion)
+            return false;
+
+        return EntriesMatch(sources, saved.sources) && EntriesMatch(outputs, saved.outputs);
+    }
+
+    bool HasOutputs()
+    {
+        foreach (TraderXBuildManifestEntry output : outputs)
+        {
+            if (output.size < 0)
+                return false;
+        }
+        return outputs.Count() > 0;
+    }
+
+    private static bool EntriesMatch(array<ref TraderXBuildManifestEntry> current, array<ref TraderXBuildManifestEntry> saved)
+    {
+        if (!saved || current.Count() != saved.Count())
+            return false;
+
+        for (int i = 0; i < current.Count(); i++)
+        {
+            if (!current[i].Equals(saved[i]))
+                return false;
+        }
+        return true;
+    }
+
+    // Size -1 for a missing file. The hash folds the hash of every line, the file is never held whole
+    private static TraderXBuildManifestEntry Fingerprint(string filePath, string fileName)
+    {
+        if (!FileExist(filePath))
+            return new TraderXBuildManifestEntry(fileName, -1, 0);
+
+        FileHandle fh = OpenFile(filePath, FileMode.READ);
+        if (!fh)
+            return new TraderXBuildManifestEntry(fileName, -1, 0);
+
+        int size = 0;
+        int hash = 17;
+        string line;
+        while (FGets(fh, line) >= 0)
+        {
+            size += line.Length() + 1;
+            hash = hash * 31 + line.Hash();
+        }
+        CloseFile(fh);
+
+        return new TraderXBuildManifestEntry(fileName, size, hash);
+    }
+
+    // The binary is full of zero bytes that a line read stops at, its raw bytes are hashed a block at a time
+    private static TraderXBuildManifestEntry FingerprintCatalogBinary()
+    {
+        string fileName = "Catalog_compiled.bin";
+        if (!FileExist(TRADERX_COMPILED_CATALOG_BINARY_FILE))
+            return new TraderXBuildManifestEntry(fileName, -1, 0);
+
+        FileHandle fh = OpenFile(TRADERX_COMPILED_CATALOG_BINARY_FILE, FileMode.READ);
+        if (!fh)
+            return new TraderXBuildManifestEntry(fileName, -1, 0);
+
+        int size = 0;
+        int hash = 17;
+        int block[BINARY_BLOCK_WORDS];
+        int bytesRead = BINARY_BLOCK_WORDS * 4;
+        while (bytesRead == BINARY_BLOCK_WORDS * 4)
+        {
+            // A short last block leaves stale words behind, clear them so the hash stays stable
+            for (int i = 0; i < BINARY_BLOCK_WORDS; i++)
+            {
+                block[i] = 0;
+            }
+
+            bytesRead = ReadFile(fh, block, BINARY_BLOCK_WORDS * 4);
+            if (bytesRead <= 0)
+                break;
+
+            size += bytesRead;
+            int words = (bytesRead + 3) / 4;
+            for (int w = 0; w < words; w++)
+            {
+                hash = hash * 31 + block[w];
+            }
+        }
+        CloseFile(fh);
+
+        return new TraderXBuildManifestEntry(fileName, size, hash);
+    }
+
+    private static void CollectFiles(string directory, string pattern, TStringArray files)
+    {
+        string filename;
+        FileAttr attr;
+        FindFileHandle findHandle = FindFile(directory + pattern, filename, attr, FindFileFlags.ALL);
+        if (findHandle == 0)
+            return;
+
+        files.Insert(filename);
+        while (FindNextFile(findHandle, filename, attr))
+        {
+            files.Insert(filename);
+        }
+        CloseFindFile(findHandle);
+    }
+}
@@ -0,0 +1,183 @@
+/**
+ * TraderXCatalogLoadCursor - Loads products and categories into their repositories a slice at a time
+ * Begin reads the source whole, either the binary tables or the compiled JSON arrays, which is one
+ * native read. Each Run then maps up to a given number of entries, products first, so the server
+ * startup can spread the mapping of a large catalog over several frames. Legacy per-file configs,
+ * the fallback when no compiled file is usable, are loaded whole in one Run.
+ */
+class TraderXCatalogLoadCursor
+{
+    private ref TraderXCompiledCatalogTables m_Tables;
+    private ref array<ref TraderXCompiledProduct> m_CompiledProducts;
+    private ref array<ref TraderXCompiledCategory> m_CompiledCategories;
+
+    private int m_NextProduct;
+    private int m_NextCategory;
+    private int m_ProductFailures;
+    private int m_CategoryFailures;
+    private bool m_ProductsDone;
+    private bool m_CategoriesDone;
+
+    /**
+     * Read the catalog source, nothing is mapped yet
+     * @param preferBinary read Catalog_compiled.bin, the compiled JSON stays the fallback
+     */
+    void Begin(bool preferBinary)
+    {
+        TraderXProductRepository.ClearProducts();
+        TraderXCategoryRepository.ClearCategories();
+
+        if (preferBinary)
+        {
+            m_Tables = new TraderXCompiledCatalogTables();
+            if (m_Tables.Load(TRADERX_COMPILED_CATALOG_BINARY_FILE) && m_Tables.GetProductCount() > 0)
+                return;
+
+            if (FileExist(TRADERX_COMPILED_CATALOG_BINARY_FILE))
+                GetTraderXLogger().LogWarning("[TraderX] Binary catalog is outdated or damaged: " + TRADERX_COMPILED_CATALOG_BINARY_FILE);
+
+            m_Tables = null;
+            GetTraderXLogger().LogWarning("[TraderX] Binary catalog unavailable, loading compiled JSON instead");
+        }
+
+        if (FileExist(TRADERX_COMPILED_PRODUCTS_FILE))
+        {
+            m_CompiledProducts = new array<ref TraderXCompiledProduct>();
+            JsonFileLoader<array<ref TraderXCompiledProduct>>.JsonLoadFile(TRADERX_COMPILED_PRODUCTS_FILE, m_CompiledProducts);
+            if (!m_CompiledProducts || m_CompiledProducts.Count() == 0)
+            {
+                GetTraderXLogger().LogError("[TraderX] Failed to load compiled products (empty or null), falling back to legacy");
+                m_CompiledProducts = null;
+            }
+        }
+
+        if (FileExist(TRADERX_COMPILED_CATEGORIES_FILE))
+        {
+            m_CompiledCategories = new array<ref TraderXCompiledCategory>();
+            JsonFileLoader<array<ref TraderXCompiledCategory>>.JsonLoadFile(TRADERX_COMPILED_CATEGORIES_FILE, m_CompiledCategories);
+            if (!m_CompiledCategories || m_CompiledCategories.Count() == 0)
+            {
+                GetTraderXLogger().LogError("[TraderX] Failed to load compiled categories (empty or null), falling back to legacy");
+                m_CompiledCategories = null;
+            }
+        }
+    }
+
+    /**
+     * Map up to maxEntries products or categories
+     * @return true once both repositories are filled
+     */
+    bool Run(int maxEntries)
+    {
+        if (!m_ProductsDone)
+        {
+            maxEntries = RunProducts(maxEntries);
+            if (!m_ProductsDone)
+                return false;
+        }
+
+        if (!m_CategoriesDone)
+            RunCategories(maxEntries);
+
+        return m_CategoriesDone;
+    }
+
+    // @return entries left in this slice
+    private int RunProducts(int maxEntries)
+    {
+        int total;
+        if (m_Tables)
+            total = m_Tables.GetProductCount();
+        else if (m_CompiledProducts)
+            total = m_CompiledProducts.Count();
+        else
+        {
+            GetTraderXLogger().LogWarning("[TraderX] Compiled config not found, using legacy multi-file JSON");
+            TraderXProductRepository.LoadFromLegacyJson();
+            m_ProductsDone = true;
+            return maxEntries;
+        }
+
+        while (m_NextProduct < total && maxEntries > 0)
+        {
+            if (m_Tables)
+                TraderXProductRepository.AddItemToItems(m_Tables.BuildProduct(m_NextProduct));
+            else if (!TraderXProductRepository.AddCompiledProduct(m_CompiledProducts[m_NextProduct]))
+                m_ProductFailures++;
+
+            m_NextProduct++;
+            maxEntries--;
+        }
+
+        if (m_NextProduct < total)
+            return 0;
+
+        m_ProductsDone = true;
+
+        if (m_CompiledProducts && m_ProductFailures == total)
+        {
+            GetTraderXLogger().LogError(string.Format("[TraderX] All %1 products failed to load from compiled file, falling back to legacy", m_ProductFailures));
+            TraderXProductRepository.LoadFromLegacyJson();
+            return maxEntries;
+        }
+
+        if (m_ProductFailures > 0)
+            GetTraderXLogger().LogWarning(string.Format("[TraderX] Loaded %1 products from compiled file, %2 failed", TraderXProductRepository.GetProductCount(), m_ProductFailures));
+        else
+            GetTraderXLogger().LogInfo(string.Format("[TraderX] Loaded %1 products from %2", TraderXProductRepository.GetProductCount(), GetSourceName()));
+
+        return maxEntries;
+    }
+
+    private void RunCategories(int maxEntries)
+    {
+        int total;
+        if (m_Tables)
+            total = m_Tables.GetCategoryCount();
+        else if (m_CompiledCategories)
+            total = m_CompiledCategories.Count();
+        else
+        {
+            GetTraderXLogger().LogWarning("[TraderX] Compiled config not found, using legacy multi-file JSON");
+            TraderXCategoryRepository.LoadFromLegacyJson();
+            m_CategoriesDone = true;
+            return;
+        }
+
+        while (m_NextCategory < total && maxEntries > 0)
+        {
+            if (m_Tables)
+                TraderXCategoryRepository.AddCategoryToCategories(m_Tables.BuildCategory(m_NextCategory));
+            else if (!TraderXCategoryRepository.AddCompiledCategory(m_CompiledCategories[m_NextCategory]))
+                m_CategoryFailures++;
+
+            m_NextCategory++;
+            maxEntries--;
+        }
+
+        if (m_NextCategory < total)
+            return;
+
+        m_CategoriesDone = true;
+
+        if (m_CompiledCategories && m_CategoryFailures == total)
+        {
+            GetTraderXLogger().LogError(string.Format("[TraderX] All %1 categories failed to load from compiled file, falling back to legacy", m_CategoryFailures));
+            TraderXCategoryRepository.LoadFromLegacyJson();
+            return;
+        }
+
+        if (m_CategoryFailures > 0)
+            GetTraderXLogger().LogWarning(string.Format("[TraderX] Loaded %1 categories from compiled file, %2 failed", TraderXCategoryRepository.GetCategoryCount(), m_CategoryFailures));
+        else
+            GetTraderXLogger().LogInfo(string.Format("[TraderX] Loaded %1 categories from %2", TraderXCategoryRepository.GetCategoryCount(), GetSourceName()));
+    }
+
+    private string GetSourceName()
+    {
+        if (m_Tables)
+            return "binary catalog";
+
+        return "compiled config";
+    }
+}
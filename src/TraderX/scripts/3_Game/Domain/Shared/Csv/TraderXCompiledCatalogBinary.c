@@ -0,0 +1,324 @@
+/**
+ * TraderX Compiled Catalog Binary - Products and categories in one FileSerializer file
+ *
+ * Written by TraderXConfigCompiler next to the compiled JSON and loaded in BINARY mode.
+ * Every string is stored once in a string table and referenced by index. Tables are stored
+ * column by column as flat arrays, so loading is a handful of native array reads instead
+ * of a reflective JSON parse. Lists (attachments, variants, licenses, productIds) are one
+ * flat array of string indices plus an offset array of count + 1 entries.
+ *
+ * Layout: MAGIC, FORMAT_VERSION, string table, product table, category table, END_MARKER
+ */
+class TraderXCompiledCatalogBinary
+{
+    static const int MAGIC = 0x54585843; // "TXXC"
+    static const int FORMAT_VERSION = 1;
+    static const int END_MARKER = 0x454E4421;
+
+    static bool Write(array<ref TraderXCompiledProduct> products, array<ref TraderXCompiledCategory> categories)
+    {
+        TStringArray strings = new TStringArray();
+        map<string, int> stringIndex = new map<string, int>();
+
+        // Product table
+        TIntArray productIds = new TIntArray();
+        TIntArray classNames = new TIntArray();
+        array<float> coefficients = new array<float>();
+        TIntArray maxStocks = new TIntArray();
+        TIntArray tradeQuantities = new TIntArray();
+        TIntArray buyPrices = new TIntArray();
+        TIntArray sellPrices = new TIntArray();
+        TIntArray stockSettings = new TIntArray();
+        TIntArray attachmentOffsets = new TIntArray();
+        TIntArray attachmentRefs = new TIntArray();
+        TIntArray variantOffsets = new TIntArray();
+        TIntArray variantRefs = new TIntArray();
+
+        foreach (TraderXCompiledProduct product : products)
+        {
+            productIds.Insert(Intern(product.productId, strings, stringIndex));
+            classNames.Insert(Intern(product.className, strings, stringIndex));
+            coefficients.Insert(product.coefficient);
+            maxStocks.Insert(product.maxStock);
+            tradeQuantities.Insert(product.tradeQuantity);
+            buyPrices.Insert(product.buyPrice);
+            sellPrices.Insert(product.sellPrice);
+            stockSettings.Insert(product.stockSettings);
+            AppendList(product.attachments, attachmentOffsets, attachmentRefs, strings, stringIndex);
+            AppendList(product.variants, variantOffsets, variantRefs, strings, stringIndex);
+        }
+        attachmentOffsets.Insert(attachmentRefs.Count());
+        variantOffsets.Insert(variantRefs.Count());
+
+        // Category table
+        TIntArray categoryIds = new TIntArray();
+        TIntArray categoryNames = new TIntArray();
+        TIntArray icons = new TIntArray();
+        TIntArray visibilities = new TIntArray();
+        TIntArray licenseOffsets = new TIntArray();
+        TIntArray licenseRefs = new TIntArray();
+        TIntArray productOffsets = new TIntArray();
+        TIntArray productRefs = new TIntArray();
+
+        foreach (TraderXCompiledCategory category : categories)
+        {
+            categoryIds.Insert(Intern(category.categoryId, strings, stringIndex));
+            categoryNames.Insert(Intern(category.categoryName, strings, stringIndex));
+            icons.Insert(Intern(category.icon, strings, stringIndex));
+            visibilities.Insert(category.isVisible);
+            AppendList(category.licensesRequired, licenseOffsets, licenseRefs, strings, stringIndex);
+            AppendList(category.productIds, productOffsets, productRefs, strings, stringIndex);
+        }
+        licenseOffsets.Insert(licenseRefs.Count());
+        productOffsets.Insert(productRefs.Count());
+
+        FileSerializer file = new FileSerializer();
+        if (!file.Open(TRADERX_COMPILED_CATALOG_BINARY_FILE, FileMode.WRITE))
+        {
+            GetTraderXLogger().LogError("Failed to open binary catalog for writing: " + TRADERX_COMPILED_CATALOG_BINARY_FILE);
+            return false;
+        }
+
+        file.Write(MAGIC);
+        file.Write(FORMAT_VERSION);
+        file.Write(strings);
+
+        file.Write(productIds);
+        file.Write(classNames);
+        file.Write(coefficients);
+        file.Write(maxStocks);
+        file.Write(tradeQuantities);
+        file.Write(buyPrices);
+        file.Write(sellPrices);
+        file.Write(stockSettings);
+        file.Write(attachmentOffsets);
+        file.Write(attachmentRefs);
+        file.Write(variantOffsets);
+        file.Write(variantRefs);
+
+        file.Write(categoryIds);
+        file.Write(categoryNames);
+        file.Write(icons);
+        file.Write(visibilities);
+        file.Write(licenseOffsets);
+        file.Write(licenseRefs);
+        file.Write(productOffsets);
+        file.Write(productRefs);
+
+        file.Write(END_MARKER);
+        file.Close();
+
+        GetTraderXLogger().LogInfo(string.Format("Saving compiled binary catalog to: %1 (%2 products, %3 categories, %4 strings)", TRADERX_COMPILED_CATALOG_BINARY_FILE, products.Count(), categories.Count(), strings.Count()));
+        return true;
+    }
+
+    static void Delete()
+    {
+        if (FileExist(TRADERX_COMPILED_CATALOG_BINARY_FILE))
+            DeleteFile(TRADERX_COMPILED_CATALOG_BINARY_FILE);
+    }
+
+    private static int Intern(string value, TStringArray strings, map<string, int> stringIndex)
+    {
+        int index;
+        if (stringIndex.Find(value, index))
+            return index;
+
+        index = strings.Insert(value);
+        stringIndex.Set(value, index);
+        return index;
+    }
+
+    private static void AppendList(array<string> values, TIntArray offsets, TIntArray refs, TStringArray strings, map<string, int> stringIndex)
+    {
+        offsets.Insert(refs.Count());
+        if (!values)
+            return;
+
+        foreach (string value : values)
+        {
+            refs.Insert(Intern(value, strings, stringIndex));
+        }
+    }
+}
+
+/**
+ * TraderXCompiledCatalogTables - The columns of the binary catalog as read from disk
+ * Load checks every column length, list offset and string index, so building the models
+ * from a loaded table cannot go out of bounds. Rows are built one at a time, which lets the
+ * server startup spread the catalog over several frames.
+ */
+class TraderXCompiledCatalogTables
+{
+    ref TStringArray strings;
+
+    ref TIntArray productIds;
+    ref TIntArray classNames;
+    ref array<float> coefficients;
+    ref TIntArray maxStocks;
+    ref TIntArray tradeQuantities;
+    ref TIntArray buyPrices;
+    ref TIntArray sellPrices;
+    ref TIntArray stockSettings;
+    ref TIntArray attachmentOffsets;
+    ref TIntArray attachmentRefs;
+    ref TIntArray variantOffsets;
+    ref TIntArray variantRefs;
+
+    ref TIntArray categoryIds;
+    ref TIntArray categoryNames;
+    ref TIntArray icons;
+    ref TIntArray visibilities;
+    ref TIntArray licenseOffsets;
+    ref TIntArray licenseRefs;
+    ref TIntArray productOffsets;
+    ref TIntArray productRefs;
+
+    void TraderXCompiledCatalogTables()
+    {
+        strings = new TStringArray();
+        productIds = new TIntArray();
+        classNames = new TIntArray();
+        coefficients = new array<float>();
+        maxStocks = new TIntArray();
+        tradeQuantities = new TIntArray();
+        buyPrices = new TIntArray();
+        sellPrices = new TIntArray();
+        stockSettings = new TIntArray();
+        attachmentOffsets = new TIntArray();
+        attachmentRefs = new TIntArray();
+        variantOffsets = new TIntArray();
+        variantRefs = new TIntArray();
+        categoryIds = new TIntArray();
+        categoryNames = new TIntArray();
+        icons = new TIntArray();
+        visibilities = new TIntArray();
+        licenseOffsets = new TIntArray();
+        licenseRefs = new TIntArray();
+        productOffsets = new TIntArray();
+        productRefs = new TIntArray();
+    }
+
+    bool Load(string filePath)
+    {
+        if (!FileExist(filePath))
+            return false;
+
+        FileSerializer file = new FileSerializer();
+        if (!file.Open(filePath, FileMode.READ))
+            return false;
+
+        int magic, version, endMarker;
+        bool ok = file.Read(magic) && magic == TraderXCompiledCatalogBinary.MAGIC && file.Read(version) && version == TraderXCompiledCatalogBinary.FORMAT_VERSION;
+        ok = ok && file.Read(strings);
+        ok = ok && file.Read(productIds) && file.Read(classNames) && file.Read(coefficients) && file.Read(maxStocks);
+        ok = ok && file.Read(tradeQuantities) && file.Read(buyPrices) && file.Read(sellPrices) && file.Read(stockSettings);
+        ok = ok && file.Read(attachmentOffsets) && file.Read(attachmentRefs) && file.Read(variantOffsets) && file.Read(variantRefs);
+        ok = ok && file.Read(categoryIds) && file.Read(categoryNames) && file.Read(icons) && file.Read(visibilities);
+        ok = ok && file.Read(licenseOffsets) && file.Read(licenseRefs) && file.Read(productOffsets) && file.Read(productRefs);
+        ok = ok && file.Read(endMarker) && endMarker == TraderXCompiledCatalogBinary.END_MARKER;
+        file.Close();
+
+        return ok && IsConsistent();
+    }
+
+    int GetProductCount()
+    {
+        return productIds.Count();
+    }
+
+    int GetCategoryCount()
+    {
+        return categoryIds.Count();
+    }
+
+    TraderXProduct BuildProduct(int row)
+    {
+        TraderXProduct product = new TraderXProduct();
+        product.productId = strings[productIds[row]];
+        product.className = strings[classNames[row]];
+        product.coefficient = coefficients[row];
+        product.maxStock = maxStocks[row];
+        product.tradeQuantity = tradeQuantities[row];
+        product.buyPrice = buyPrices[row];
+        product.sellPrice = sellPrices[row];
+        product.stockSettings = stockSettings[row];
+        product.attachments = ReadList(row, attachmentOffsets, attachmentRefs);
+        product.variants = ReadList(row, variantOffsets, variantRefs);
+        return product;
+    }
+
+    TraderXCategory BuildCategory(int row)
+    {
+        TraderXCategory category = new TraderXCategory();
+        category.categoryId = strings[categoryIds[row]];
+        category.categoryName = strings[categoryNames[row]];
+        category.icon = strings[icons[row]];
+        category.isVisible = visibilities[row] != 0;
+        category.licensesRequired = ReadList(row, licenseOffsets, licenseRefs);
+        category.productIds = ReadList(row, productOffsets, productRefs);
+        return category;
+    }
+
+    private TStringArray ReadList(int row, TIntArray offsets, TIntArray refs)
+    {
+        TStringArray values = new TStringArray();
+        int end = offsets[row + 1];
+        for (int i = offsets[row]; i < end; i++)
+        {
+            values.Insert(strings[refs[i]]);
+        }
+        return values;
+    }
+
+    private bool IsConsistent()
+    {
+        int productRows = productIds.Count();
+        if (classNames.Count() != productRows || coefficients.Count() != productRows || maxStocks.Count() != productRows)
+            return false;
+
+        if (tradeQuantities.Count() != productRows || buyPrices.Count() != productRows || sellPrices.Count() != productRows || stockSettings.Count() != productRows)
+            return false;
+
+        int categoryRows = categoryIds.Count();
+        if (categoryNames.Count() != categoryRows || icons.Count() != categoryRows || visibilities.Count() != categoryRows)
+            return false;
+
+        if (!AreOffsetsValid(attachmentOffsets, productRows, attachmentRefs.Count()) || !AreOffsetsValid(variantOffsets, productRows, variantRefs.Count()))
+            return false;
+
+        if (!AreOffsetsValid(licenseOffsets, categoryRows, licenseRefs.Count()) || !AreOffsetsValid(productOffsets, categoryRows, productRefs.Count()))
+            return false;
+
+        int stringCount = strings.Count();
+        return AreStringRefsValid(productIds, stringCount) && AreStringRefsValid(classNames, stringCount)
+            && AreStringRefsValid(attachmentRefs, stringCount) && AreStringRefsValid(variantRefs, stringCount)
+            && AreStringRefsValid(categoryIds, stringCount) && AreStringRefsValid(categoryNames, stringCount)
+            && AreStringRefsValid(icons, stringCount) && AreStringRefsValid(licenseRefs, stringCount)
+            && AreStringRefsValid(productRefs, stringCount);
+    }
+
+    // rows + 1 entries starting at 0, never decreasing and ending at the list length
+    private static bool AreOffsetsValid(TIntArray offsets, int rows, int refCount)
+    {
+        if (offsets.Count() != rows + 1 || offsets[0] != 0 || offsets[rows] != refCount)
+            return false;
+
+        for (int i = 0; i < rows; i++)
+        {
+            if (offsets[i] > offsets[i + 1])
+                return false;
+        }
+        return true;
+    }
+
+    private static bool AreStringRefsValid(TIntArray refs, int stringCount)
+    {
+        foreach (int index : refs)
+        {
+            if (index < 0 || index >= stringCount)
+                return false;
+        }
+        return true;
+    }
+}
@@ -12,6 +12,9 @@
  * 6. Compile to optimized runtime JSON
  * 7. Create backups
  * 
+ * Steps 2 to 7 are skipped when the build manifest shows that neither the sources
+ * nor the compiled output changed since the last successful compilation.
+ * 
  * Domain Services Used:
  * - TraderXSourceFormatDetector: Detects CSV/JSON format
  * - TraderXFormatMigrator: Handles format migrations
@@ -49,6 +52,14 @@ class TraderXConfigCompiler
             MakeDirectory(TRADERX_BACKUP_DIR);
         }
         
+        // Nothing changed since the last successful compilation, the compiled files are current
+        TraderXBuildManifest currentBuild = TraderXBuildManifest.Capture();
+        if (currentBuild.HasOutputs() && currentBuild.Matches(TraderXBuildManifest.Load()))
+        {
+            GetTraderXLogger().LogInfo("=== TraderX Configuration unchanged since last compilation, using compiled files ===");
+            return true;
+        }
+        
         // Use domain services for format detection and migration
         TraderXSourceFormatDetector formatDetector = new TraderXSourceFormatDetector(TRADERX_CSV_SOURCE_DIR);
         string currentFormat = formatDetector.DetectFormat();
@@ -114,6 +125,9 @@ class TraderXConfigCompiler
         // Create backup of successful compilation
         CreateBackup();
         
+        // Fingerprint after compiling, a format migration may have rewritten the sources
+        TraderXBuildManifest.Capture().Save();
+        
         GetTraderXLogger().LogInfo("=== TraderX Configuration Compilation Complete ===");
         return true;
     }
@@ -444,6 +458,9 @@ class TraderXConfigCompiler
         GetTraderXLogger().LogInfo("Saving compiled categories to: " + categoriesPath);
         JsonFileLoader<array<ref TraderXCompiledCategory>>.JsonSaveFile(categoriesPath, jsonCategories);
         
+        // Same catalog in binary form for BINARY mode, the JSON stays the readable copy
+        TraderXCompiledCatalogBinary.Write(jsonProducts, jsonCategories);
+        
         // Compile presets if any
         if (presets.Count() > 0)
         {
@@ -606,6 +623,10 @@ class TraderXConfigCompiler
     {
         GetTraderXLogger().LogWarning("Attempting to restore from backup...");
         
+        // The compiled files no longer come from the current sources
+        TraderXBuildManifest.Delete();
+        TraderXCompiledCatalogBinary.Delete();
+        
         string productsBackup = TRADERX_COMPILED_PRODUCTS_BACKUP;
         string categoriesBackup = TRADERX_COMPILED_CATEGORIES_BACKUP;
         
@@ -0,0 +1,208 @@
+// TraderX CSV Reader - Streams a CSV file one row at a time
+// The header is read on Open, callers resolve the columns they need to indices once with
+// GetColumnIndex and read every row through those indices. Fields are cut out of the line as
+// substrings between delimiters, only one row is held in memory at a time.
+class TraderXCsvReader
+{
+    private FileHandle m_File;
+    private string m_FilePath;
+    private string m_Delimiter;
+    private int m_LineNumber;
+    private int m_RowCount;
+
+    private ref map<string, int> m_ColumnByName;
+    private ref TStringArray m_Fields;
+
+    void TraderXCsvReader(string delimiter = "\t")
+    {
+        m_Delimiter = delimiter;
+        m_ColumnByName = new map<string, int>();
+        m_Fields = new TStringArray();
+    }
+
+    void ~TraderXCsvReader()
+    {
+        Close();
+    }
+
+    // Open the file and read its header, false when missing, unreadable or empty
+    bool Open(string filePath)
+    {
+        m_FilePath = filePath;
+
+        if (!FileExist(filePath))
+        {
+            GetTraderXLogger().LogError("[TraderXCsvLoader] File not found: " + filePath);
+            return false;
+        }
+
+        m_File = OpenFile(filePath, FileMode.READ);
+        if (m_File == 0)
+        {
+            GetTraderXLogger().LogError("[TraderXCsvLoader] Failed to open file: " + filePath);
+            return false;
+        }
+
+        if (!ReadRow())
+        {
+            Close();
+            return false;
+        }
+
+        foreach (int index, string header : m_Fields)
+        {
+            header.ToLower();
+            m_ColumnByName.Set(header, index);
+        }
+
+        m_RowCount = 0;
+        return true;
+    }
+
+    void Close()
+    {
+        if (m_File == 0)
+            return;
+
+        CloseFile(m_File);
+        m_File = 0;
+
+        GetTraderXLogger().LogDebug(string.Format("[TraderXCsvLoader] Parsed %1 lines from %2", m_LineNumber, m_FilePath));
+    }
+
+    // -1 when the header has no such column, every getter returns the empty value for it
+    int GetColumnIndex(string columnName)
+    {
+        int index;
+        if (m_ColumnByName.Find(columnName, index))
+            return index;
+
+        return -1;
+    }
+
+    /**
+     * Advance to the next non-empty line
+     * @return false at end of file
+     */
+    bool ReadRow()
+    {
+        if (m_File == 0)
+            return false;
+
+        string line;
+        while (FGets(m_File, line) >= 0)
+        {
+            m_LineNumber++;
+
+            line.Trim();
+            if (line.Length() == 0)
+                continue;
+
+            SplitLine(line);
+            m_RowCount++;
+            return true;
+        }
+
+        return false;
+    }
+
+    // Data rows read so far, the header excluded
+    int GetRowCount()
+    {
+        return m_RowCount;
+    }
+
+    int GetLineNumber()
+    {
+        return m_LineNumber;
+    }
+
+    int GetFieldCount()
+    {
+        return m_Fields.Count();
+    }
+
+    string GetString(int column)
+    {
+        if (column < 0 || column >= m_Fields.Count())
+            return "";
+
+        return m_Fields[column];
+    }
+
+    int GetInt(int column)
+    {
+        string val = GetString(column);
+        if (val.Length() == 0)
+            return 0;
+        return val.ToInt();
+    }
+
+    float GetFloat(int column)
+    {
+        string val = GetString(column);
+        if (val.Length() == 0)
+            return 0.0;
+        return val.ToFloat();
+    }
+
+    bool GetBool(int column)
+    {
+        string val = GetString(column);
+        val.ToLower();
+        return (val == "1" || val == "true" || val == "yes");
+    }
+
+    // Split on the delimiter, quotes are dropped and protect the delimiters between them
+    private void SplitLine(string line)
+    {
+        m_Fields.Clear();
+
+        if (line.IndexOf("\"") == -1)
+        {
+            int start = 0;
+            int next = line.IndexOfFrom(start, m_Delimiter);
+            while (next != -1)
+            {
+                AddField(line.Substring(start, next - start));
+                start = next + 1;
+                next = line.IndexOfFrom(start, m_Delimiter);
+            }
+            AddField(line.Substring(start, line.Length() - start));
+            return;
+        }
+
+        // Quoted line: copy the spans between quotes and delimiters, not single characters
+        bool inQuotes = false;
+        string field = "";
+        int spanStart = 0;
+        int len = line.Length();
+        for (int i = 0; i < len; i++)
+        {
+            string ch = line.Get(i);
+            if (ch == "\"")
+            {
+                field += line.Substring(spanStart, i - spanStart);
+                spanStart = i + 1;
+                inQuotes = !inQuotes;
+                continue;
+            }
+
+            if (ch == m_Delimiter && !inQuotes)
+            {
+                field += line.Substring(spanStart, i - spanStart);
+                AddField(field);
+                field = "";
+                spanStart = i + 1;
+            }
+        }
+        field += line.Substring(spanStart, len - spanStart);
+        AddField(field);
+    }
+
+    private void AddField(string field)
+    {
+        field.Trim();
+        m_Fields.Insert(field);
+    }
+}
@@ -3,13 +3,14 @@ enum ETraderXSourceFormat
 {
     LEGACY,     // Individual JSON files in Products/ and Categories/ folders
     CSV,        // CSV files in Source/ folder (products.csv, categories.csv)
-    COMPILED    // Compiled JSON files in Compiled/ folder
+    COMPILED,   // Compiled JSON files in Compiled/ folder
+    BINARY      // Sources compiled to Compiled/Catalog_compiled.bin, loaded with FileSerializer
 };
 
 // TraderX Source Configuration - User preferences for source format
 class TraderXSourceConfig
 {
-    string preferredFormat;     // "LEGACY", "CSV", or "COMPILED"
+    string preferredFormat;     // "LEGACY", "CSV", "COMPILED" or "BINARY"
     bool autoMigrate;          // Auto-migrate from legacy when starting fresh
     bool allowCompilation;     // Allow CSV -> Compiled JSON compilation
     
@@ -30,6 +31,7 @@ class TraderXSourceConfig
         {
             case "CSV": return ETraderXSourceFormat.CSV;
             case "COMPILED": return ETraderXSourceFormat.COMPILED;
+            case "BINARY": return ETraderXSourceFormat.BINARY;
             default: return ETraderXSourceFormat.LEGACY;
         }
         
@@ -74,6 +76,11 @@ class TraderXSourceConfigLoader
         return config;
     }
     
+    static string GetConfigPath()
+    {
+        return CONFIG_PATH;
+    }
+    
     static void SaveConfig(TraderXSourceConfig config)
     {
         JsonFileLoader<TraderXSourceConfig>.JsonSaveFile(CONFIG_PATH, config);
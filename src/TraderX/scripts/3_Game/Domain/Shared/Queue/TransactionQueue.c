@@ -1,50 +1,146 @@
+// What EnQueue does when a bounded queue is full
+enum ETraderXQueueOverflowPolicy
+{
+    REJECT,         // Refuse the new element, EnQueue returns false
+    DROP_OLDEST     // Evict the element at the head to make room
+};
+
 //FIFO Queue for handling transaction such as banking transaction or item transaction
+//Backed by a ring buffer: EnQueue, DeQueue and Peek are O(1)
+//A capacity <= 0 means unbounded, the buffer then doubles when it is full
 class TransactionQueue<Class T>
 {
+    private static const int DEFAULT_INITIAL_SIZE = 16;
+
     private ref array<ref T> queue;
+    private int head;
+    private int count;
+    private int capacity;
+    private ETraderXQueueOverflowPolicy overflowPolicy;
+    private int droppedCount;
+    private int rejectedCount;
 
-    void TransactionQueue()
+    void TransactionQueue(int maxCapacity = 0, ETraderXQueueOverflowPolicy policy = ETraderXQueueOverflowPolicy.REJECT)
     {
+      capacity = maxCapacity;
+      overflowPolicy = policy;
+
       queue = new array<ref T>();
+      if(capacity > 0)
+        queue.Resize(capacity);
+      else
+        queue.Resize(DEFAULT_INITIAL_SIZE);
     }
 
     int Count()
     {
-      return queue.Count();
+      return count;
+    }
+
+    int GetCapacity()
+    {
+      return capacity;
+    }
+
+    bool IsBounded()
+    {
+      return capacity > 0;
+    }
+
+    bool IsFull()
+    {
+      return IsBounded() && count >= capacity;
     }
 
     bool IsMaxQueue(int max)
     {
-      if(queue.Count() > max)
+      if(count > max)
         return true;
-      
+
       return false;
     }
 
-    void EnQueue(T product)
+    bool EnQueue(T product)
     {
-      queue.Insert(product);
+      if(IsFull())
+      {
+        if(overflowPolicy == ETraderXQueueOverflowPolicy.REJECT)
+        {
+          rejectedCount++;
+          return false;
+        }
+
+        DeQueue();
+        droppedCount++;
+      }
+      else if(count == queue.Count())
+      {
+        Grow();
+      }
+
+      queue.Set((head + count) % queue.Count(), product);
+      count++;
+      return true;
     }
 
     void DeQueue()
     {
-      for(int i = 1; i < queue.Count(); i++)
-      {
-        queue.Set(i - 1, queue[i]);
-      }
+      if(count == 0)
+        return;
 
-      i--;
+      // Release the slot so the element can be collected
+      queue.Set(head, null);
+      head = (head + 1) % queue.Count();
+      count--;
 
-      queue.RemoveOrdered(i);
+      if(count == 0)
+        head = 0;
     }
 
     T Peek()
     {
-      return queue[0];
+      return queue[head];
     }
 
     bool HasNextQueue()
     {
-      return queue.IsValidIndex(0);
+      return count > 0;
+    }
+
+    void Clear()
+    {
+      for(int i = 0; i < queue.Count(); i++)
+      {
+        queue.Set(i, null);
+      }
+
+      head = 0;
+      count = 0;
+    }
+
+    int GetDroppedCount()
+    {
+      return droppedCount;
+    }
+
+    int GetRejectedCount()
+    {
+      return rejectedCount;
+    }
+
+    // Unbounded queues only: unroll the ring into a buffer twice as large
+    private void Grow()
+    {
+      int oldSize = queue.Count();
+      array<ref T> grown = new array<ref T>();
+      grown.Resize(oldSize * 2);
+
+      for(int i = 0; i < count; i++)
+      {
+        grown.Set(i, queue[(head + i) % oldSize]);
+      }
+
+      queue = grown;
+      head = 0;
     }
 }
@@ -0,0 +1,103 @@
+/**
+ * TraderXClassMetadata
+ * Static facts about an item class, read from the game config instead of spawning a probe entity
+ */
+class TraderXClassMetadata
+{
+    string className;
+    string configPath;          // CfgVehicles, CfgWeapons or CfgMagazines, empty when the class is unknown
+
+    bool isItem;                // Sold as an inventory item (Inventory_Base, weapon or magazine)
+    bool isMagazine;            // Magazine, ammunition piles excluded
+    bool isAmmunition;
+    bool hasVarQuantity;
+    bool canBeSplit;
+    int maxQuantity;            // What QuantityConversions reports as max, 1 for items without quantity, 0 for non items
+    int stackSize;              // varStackMax, 0 when not set
+
+    bool isTransport;
+    bool isCar;
+    bool isBoat;
+
+    ref TStringArray inventorySlots;
+
+    void TraderXClassMetadata(string className)
+    {
+        this.className = className;
+        inventorySlots = new TStringArray();
+        Read();
+    }
+
+    bool Exists()
+    {
+        return configPath != "";
+    }
+
+    private void Read()
+    {
+        configPath = ResolveConfigPath(className);
+        if (configPath == "")
+            return;
+
+        string basePath = configPath + " " + className;
+
+        canBeSplit = GetGame().ConfigGetInt(basePath + " canBeSplit") == 1;
+        stackSize = GetGame().ConfigGetFloat(basePath + " varStackMax");
+
+        if (configPath == CFG_MAGAZINESPATH)
+        {
+            // Magazines report their ammo capacity
+            isItem = true;
+            isAmmunition = GetGame().IsKindOf(className, "Ammunition_Base");
+            isMagazine = !isAmmunition;
+            maxQuantity = GetGame().ConfigGetInt(basePath + " count");
+            hasVarQuantity = maxQuantity > 0;
+        }
+        else if (configPath == CFG_WEAPONSPATH)
+        {
+            // Weapons carry no quantity, one weapon is one unit
+            isItem = true;
+            maxQuantity = 1;
+        }
+        else if (configPath == CFG_VEHICLESPATH)
+        {
+            isItem = GetGame().IsKindOf(className, "Inventory_Base");
+            isTransport = GetGame().IsKindOf(className, "Transport");
+            isCar = GetGame().IsKindOf(className, "CarScript");
+            isBoat = GetGame().IsKindOf(className, "BoatScript");
+
+            if (isItem)
+            {
+                float varQuantityMax = GetGame().ConfigGetFloat(basePath + " varQuantityMax");
+                hasVarQuantity = varQuantityMax > 0;
+
+                // Same order as ItemBase.GetTargetQuantityMax for an item outside any slot
+                if (canBeSplit && stackSize > 0)
+                    maxQuantity = stackSize;
+                else
+                    maxQuantity = varQuantityMax;
+            }
+        }
+
+        // Mirrors QuantityConversions: items without quantity count as one
+        if (isItem && maxQuantity <= 0)
+            maxQuantity = 1;
+
+        if (GetGame().ConfigIsExisting(basePath + " inventorySlot"))
+            GetGame().ConfigGetTextArray(basePath + " inventorySlot", inventorySlots);
+    }
+
+    private static string ResolveConfigPath(string className)
+    {
+        if (GetGame().ConfigIsExisting(CFG_VEHICLESPATH + " " + className))
+            return CFG_VEHICLESPATH;
+
+        if (GetGame().ConfigIsExisting(CFG_WEAPONSPATH + " " + className))
+            return CFG_WEAPONSPATH;
+
+        if (GetGame().ConfigIsExisting(CFG_MAGAZINESPATH + " " + className))
+            return CFG_MAGAZINESPATH;
+
+        return "";
+    }
+}
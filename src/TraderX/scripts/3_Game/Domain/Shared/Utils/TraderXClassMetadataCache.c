@@ -0,0 +1,38 @@
+/**
+ * TraderXClassMetadataCache
+ * Lazily filled className -> TraderXClassMetadata lookup. Config reads happen once per class,
+ * every later query is a map lookup and nothing is ever spawned.
+ */
+class TraderXClassMetadataCache
+{
+    private static ref map<string, ref TraderXClassMetadata> s_MetadataByClassName = new map<string, ref TraderXClassMetadata>();
+
+    static TraderXClassMetadata Get(string className)
+    {
+        string key = className;
+        key.ToLower();
+
+        TraderXClassMetadata metadata = s_MetadataByClassName.Get(key);
+        if (!metadata)
+        {
+            metadata = new TraderXClassMetadata(className);
+            s_MetadataByClassName.Set(key, metadata);
+        }
+        return metadata;
+    }
+
+    static int GetMaxQuantity(string className)
+    {
+        return Get(className).maxQuantity;
+    }
+
+    static bool IsTransport(string className)
+    {
+        return Get(className).isTransport;
+    }
+
+    static bool IsMagazine(string className)
+    {
+        return Get(className).isMagazine;
+    }
+}
@@ -0,0 +1,121 @@
+/**
+ * TraderXLatencyHistogram - Fixed-bucket histogram for latencies and sizes
+ * Recording is a bucket search plus two additions, no sample is kept. Percentiles are
+ * answered with the upper bound of the bucket that holds them, which is precise enough
+ * to tell a 2 ms stage from a 50 ms one. Counts are cumulative like a Prometheus histogram.
+ */
+class TraderXLatencyHistogram
+{
+    // Upper bounds in milliseconds, the last bucket catches everything above
+    static const ref array<float> LATENCY_BOUNDS_MS = {0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 25, 50, 100, 250, 500, 1000};
+    static const ref array<float> SIZE_BOUNDS = {1, 2, 4, 8, 16, 32, 64, 128};
+
+    private ref array<float> m_Bounds;
+    private ref TIntArray m_Counts;
+    private int m_Count;
+    private float m_Sum;
+    private float m_Max;
+
+    void TraderXLatencyHistogram(array<float> bounds)
+    {
+        m_Bounds = bounds;
+        m_Counts = new TIntArray();
+        for (int i = 0; i <= bounds.Count(); i++)
+        {
+            m_Counts.Insert(0);
+        }
+    }
+
+    static TraderXLatencyHistogram CreateLatency()
+    {
+        return new TraderXLatencyHistogram(LATENCY_BOUNDS_MS);
+    }
+
+    static TraderXLatencyHistogram CreateSize()
+    {
+        return new TraderXLatencyHistogram(SIZE_BOUNDS);
+    }
+
+    void Record(float value)
+    {
+        int bucket = m_Bounds.Count();
+        for (int i = 0; i < m_Bounds.Count(); i++)
+        {
+            if (value <= m_Bounds[i])
+            {
+                bucket = i;
+                break;
+            }
+        }
+
+        m_Counts[bucket] = m_Counts[bucket] + 1;
+        m_Count++;
+        m_Sum += value;
+        if (value > m_Max)
+            m_Max = value;
+    }
+
+    int GetCount()
+    {
+        return m_Count;
+    }
+
+    float GetSum()
+    {
+        return m_Sum;
+    }
+
+    float GetMax()
+    {
+        return m_Max;
+    }
+
+    /**
+     * Upper bound of the bucket holding the given quantile
+     * @param quantile between 0 and 1, e.g. 0.95
+     * @return bucket bound, or the observed max for the overflow bucket
+     */
+    float GetPercentile(float quantile)
+    {
+        if (m_Count == 0)
+            return 0;
+
+        int rank = Math.Ceil(quantile * m_Count);
+        if (rank < 1)
+            rank = 1;
+
+        int seen = 0;
+        for (int i = 0; i < m_Bounds.Count(); i++)
+        {
+            seen += m_Counts[i];
+            if (seen >= rank)
+                return Math.Min(m_Bounds[i], m_Max);
+        }
+        return m_Max;
+    }
+
+    /**
+     * Append the histogram in Prometheus text exposition format
+     * @param name metric name, labels extra labels without braces (e.g. stage="pricing")
+     */
+    void AppendExposition(TStringArray lines, string name, string labels)
+    {
+        string prefix = labels;
+        if (prefix != "")
+            prefix += ",";
+
+        int cumulative = 0;
+        for (int i = 0; i < m_Bounds.Count(); i++)
+        {
+            cumulative += m_Counts[i];
+            lines.Insert(string.Format("%1_bucket{%2le=\"%3\"} %4", name, prefix, m_Bounds[i], cumulative));
+        }
+        lines.Insert(string.Format("%1_bucket{%2le=\"+Inf\"} %3", name, prefix, m_Count));
+
+        string labelBlock = "";
+        if (labels != "")
+            labelBlock = "{" + labels + "}";
+        lines.Insert(string.Format("%1_sum%2 %3", name, labelBlock, m_Sum));
+        lines.Insert(string.Format("%1_count%2 %3", name, labelBlock, m_Count));
+    }
+}
@@ -77,8 +77,9 @@ class TraderXTransaction
         bool hasValidMultiplier = multiplier > 0;
         bool hasValidPrice = unitPrice && unitPrice.IsValidPrice();
         
-        GetTraderXLogger().LogInfo(string.Format("IsValid - hasId: %1, hasType: %2, multiplier: %3 (valid: %4), price valid: %5", 
-            hasId, hasType, multiplier, hasValidMultiplier, hasValidPrice));
+        if (GetTraderXLogger().IsEnabled(TraderXLogLevel.Info))
+            GetTraderXLogger().LogFormat(TraderXLogLevel.Info, "IsValid - hasId: %1, hasType: %2, multiplier: %3 (valid: %4), price valid: %5", 
+                hasId.ToString(), hasType.ToString(), multiplier.ToString(), hasValidMultiplier.ToString(), hasValidPrice.ToString());
             
         if (!hasId) GetTraderXLogger().LogError("Transaction validation failed: missing transaction ID");
         if (!hasType) GetTraderXLogger().LogError("Transaction validation failed: missing transaction type");
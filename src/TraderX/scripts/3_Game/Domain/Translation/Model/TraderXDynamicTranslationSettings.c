@@ -35,6 +35,7 @@ class TraderXDynamicTranslationSettings
     string traderStockFull = "Trader stock is full";
     string saleSuccessful = "Sale successful";
     string invalidPrice = "Invalid price - transactions with negative prices are not allowed";
+    string transactionQueueFull = "Trader is busy, please try again in a moment";
     
     // Transaction error prefixes
     string purchaseFailedPrefix = "Purchase failed: ";
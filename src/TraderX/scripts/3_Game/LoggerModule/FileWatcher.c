@@ -0,0 +1,63 @@
+// Detects edits to a small config file by comparing its size and content hash
+class TraderXFileWatcher
+{
+    private string m_Path;
+    private int m_Size = -1;
+    private int m_Hash = 0;
+
+    void TraderXFileWatcher(string path)
+    {
+        m_Path = path;
+    }
+
+    // Takes the current content as the reference, returns false if the file could not be read
+    bool Snapshot()
+    {
+        string content;
+        if (!ReadContent(content))
+        {
+            m_Size = -1;
+            return false;
+        }
+
+        m_Size = content.Length();
+        m_Hash = content.Hash();
+        return true;
+    }
+
+    // True when the file differs from the last snapshot, the snapshot is updated
+    bool HasChanged()
+    {
+        string content;
+        if (!ReadContent(content))
+            return false;
+
+        int size = content.Length();
+        int hash = content.Hash();
+        if (size == m_Size && hash == m_Hash)
+            return false;
+
+        m_Size = size;
+        m_Hash = hash;
+        return true;
+    }
+
+    private bool ReadContent(out string content)
+    {
+        content = "";
+        if (!FileExist(m_Path))
+            return false;
+
+        FileHandle fh = OpenFile(m_Path, FileMode.READ);
+        if (!fh)
+            return false;
+
+        string line;
+        while (FGets(fh, line) >= 0)
+        {
+            content += line + "\n";
+        }
+        CloseFile(fh);
+        return true;
+    }
+}
@@ -0,0 +1,80 @@
+// One captured log call. Formatting is deferred to the flush, the entry only keeps the raw parts
+class TraderXLogEntry
+{
+    int secondOfDay;
+    TraderXLogLevel logLevel;
+    string message;
+
+    // Captured arguments, only used when hasParams is set
+    bool hasParams;
+    string param1, param2, param3, param4, param5, param6, param7, param8, param9;
+
+    string Format()
+    {
+        string content = message;
+        if (hasParams)
+            content = string.Format(message, param1, param2, param3, param4, param5, param6, param7, param8, param9);
+
+        int hour = secondOfDay / 3600;
+        int minute = (secondOfDay / 60) % 60;
+        int second = secondOfDay % 60;
+        return "" + hour + "_" + minute + "_" + second + " | " + TraderXLoggingModule.GetLogLevelString(logLevel) + " | " + content;
+    }
+}
+
+// Fixed size ring of reusable entries, the logger drains it in batches
+class TraderXLogRingBuffer
+{
+    private ref array<ref TraderXLogEntry> m_Entries;
+    private int m_Head;
+    private int m_Count;
+
+    void TraderXLogRingBuffer(int capacity)
+    {
+        m_Entries = new array<ref TraderXLogEntry>();
+        for (int i = 0; i < capacity; i++)
+        {
+            m_Entries.Insert(new TraderXLogEntry());
+        }
+    }
+
+    int Count()
+    {
+        return m_Count;
+    }
+
+    int GetCapacity()
+    {
+        return m_Entries.Count();
+    }
+
+    bool IsFull()
+    {
+        return m_Count >= m_Entries.Count();
+    }
+
+    // Hands out the next free slot for the caller to fill, the oldest entry is overwritten when full
+    TraderXLogEntry Acquire()
+    {
+        int capacity = m_Entries.Count();
+        TraderXLogEntry entry = m_Entries[(m_Head + m_Count) % capacity];
+        if (m_Count < capacity)
+            m_Count++;
+        else
+            m_Head = (m_Head + 1) % capacity;
+
+        entry.hasParams = false;
+        return entry;
+    }
+
+    TraderXLogEntry Get(int index)
+    {
+        return m_Entries[(m_Head + index) % m_Entries.Count()];
+    }
+
+    void Clear()
+    {
+        m_Head = 0;
+        m_Count = 0;
+    }
+}
@@ -15,6 +15,18 @@ class TraderXLoggingModule : CF_ModuleGame
 
     float dtime = 0;
 
+    // Settings are only reloaded when the file on disk actually changed
+    private ref TraderXFileWatcher m_SettingsWatcher;
+
+    // Lines wait here until the next batch flush
+    private ref TraderXLogRingBuffer m_Buffer;
+    private float m_FlushTimer = 0;
+
+    // Rotation state for the current session
+    private string m_SessionTimestamp;
+    private int m_FilePart = 0;
+    private int m_FileBytes = 0;
+    private ref TStringArray m_SessionFiles = new TStringArray();
 
     override void OnInit()
     {
@@ -22,20 +34,26 @@ class TraderXLoggingModule : CF_ModuleGame
         
         EnableUpdate();
         EnableMissionStart();
+        EnableMissionFinish();
     }
 
     override void OnMissionStart(Class sender, CF_EventArgs args)
     {
         super.OnMissionStart(sender, args);
 
+        m_SessionTimestamp = GenerateFullTimestamp();
         fileHandle = CreateNewLogFile();
 
         if(GetGame().IsServer())
         {
             settings = TraderXLoggingSettings.Load();
+            ResizeBuffer();
+
+            m_SettingsWatcher = new TraderXFileWatcher(TRADERX_LOGGER_CONFIG_FILE);
+            m_SettingsWatcher.Snapshot();
 
+            // Nobody is connected yet, joiners receive the level through SendLogLevel
             networkSync_LogLevel = settings.logLevel;
-            SynchLogLevel();       
         }
         else
         {
@@ -43,6 +61,19 @@ class TraderXLoggingModule : CF_ModuleGame
         }
     }
 
+    override void OnMissionFinish(Class sender, CF_EventArgs args)
+    {
+        super.OnMissionFinish(sender, args);
+
+        Flush();
+
+        if(fileHandle != 0)
+        {
+            CloseFile(fileHandle);
+            fileHandle = 0;
+        }
+    }
+
     void GetLogLevelResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
 	{
 		 if (type != CallType.Client)
@@ -60,10 +91,23 @@ class TraderXLoggingModule : CF_ModuleGame
         GetRPCManager().SendRPC(ClassName(), "GetLogLevelResponse",  new Param1<int>(networkSync_LogLevel), true, NULL);
     }
 
+    // Called once per joining player
+    void SendLogLevel(PlayerIdentity identity)
+    {
+        GetRPCManager().SendRPC(ClassName(), "GetLogLevelResponse",  new Param1<int>(networkSync_LogLevel), true, identity);
+    }
+
     override void OnUpdate(Class sender, CF_EventArgs args)
     {
         auto update = CF_EventUpdateArgs.Cast(args);
 
+        m_FlushTimer += update.DeltaTime;
+        if(m_FlushTimer >= GetSettings().flushIntervalSeconds)
+        {
+            m_FlushTimer = 0;
+            Flush();
+        }
+
         if(!GetGame().IsServer())
             return;
 
@@ -74,12 +118,42 @@ class TraderXLoggingModule : CF_ModuleGame
         if(dtime >= settings.refreshRateInSeconds)
         {
             dtime = 0;
+            ReloadSettingsIfChanged();
+        }
+    }
 
-            settings = TraderXLoggingSettings.Load();
+    private void ReloadSettingsIfChanged()
+    {
+        if(!m_SettingsWatcher || !m_SettingsWatcher.HasChanged())
+            return;
 
-            networkSync_LogLevel = settings.logLevel;
-            SynchLogLevel();
-        }
+        settings = TraderXLoggingSettings.Load();
+        ResizeBuffer();
+
+        if(settings.logLevel == networkSync_LogLevel)
+            return;
+
+        networkSync_LogLevel = settings.logLevel;
+        SynchLogLevel();
+    }
+
+    // Clients never load the settings file and run on the defaults
+    TraderXLoggingSettings GetSettings()
+    {
+        if(!settings)
+            settings = new TraderXLoggingSettings();
+
+        return settings;
+    }
+
+    private void ResizeBuffer()
+    {
+        int capacity = Math.Max(GetSettings().bufferCapacity, 16);
+        if(m_Buffer && m_Buffer.GetCapacity() == capacity)
+            return;
+
+        Flush();
+        m_Buffer = new TraderXLogRingBuffer(capacity);
     }
 
 
@@ -124,26 +198,142 @@ class TraderXLoggingModule : CF_ModuleGame
     {
         MakeDirectoryIfNotExists();
 
-        string filePath = string.Format(TRADERX_LOGGER_LOG_FILE, GenerateFullTimestamp());
+        // Rotated parts of a session share its timestamp: TraderX_<timestamp>.log, TraderX_<timestamp>_1.log, ...
+        string fileName = m_SessionTimestamp;
+        if(m_FilePart > 0)
+            fileName += "_" + m_FilePart;
+
+        string filePath = string.Format(TRADERX_LOGGER_LOG_FILE, fileName);
 
         fileHandle = OpenFile(filePath, FileMode.WRITE);
 
         if(fileHandle != 0)
         {
-            FPrintln(fileHandle, "Creation Time: " + GenerateFullTimestamp());
+            string header = "Creation Time: " + GenerateFullTimestamp();
+            FPrintln(fileHandle, header);
+            m_FileBytes = header.Length() + 1;
+            m_SessionFiles.Insert(filePath);
+            DeleteOldSessionFiles();
             return fileHandle;
         }
 
         return null;
     }
 
+    private void RotateLogFile()
+    {
+        CloseFile(fileHandle);
+        m_FilePart++;
+        fileHandle = CreateNewLogFile();
+    }
+
+    private void DeleteOldSessionFiles()
+    {
+        int maxFiles = Math.Max(GetSettings().maxRotatedFiles, 1);
+        while(m_SessionFiles.Count() > maxFiles)
+        {
+            DeleteFile(m_SessionFiles[0]);
+            m_SessionFiles.Remove(0);
+        }
+    }
+
+    /**
+     * Cheap level check, guard expensive message building with it
+     */
+    bool IsEnabled(TraderXLogLevel logLevel)
+    {
+        return logLevel >= networkSync_LogLevel;
+    }
+
     void Log(string content, TraderXLogLevel logLevel)
     {
         if(logLevel < networkSync_LogLevel)
             return;
-        
-        string timestamp = GenerateShortTimeString();
-        FPrintln(fileHandle, timestamp + " | " + GetLogLevelString(logLevel) + " | " + content);
+
+        Enqueue(content, logLevel);
+
+        // Errors bypass the timer, they are the lines we want on disk if the server goes down
+        if(logLevel == TraderXLogLevel.Error)
+            Flush();
+    }
+
+    /**
+     * Captures the format and its arguments, string.Format only runs when the batch is written
+     */
+    void LogFormat(TraderXLogLevel logLevel, string format, string param1 = "", string param2 = "", string param3 = "", string param4 = "", string param5 = "", string param6 = "", string param7 = "", string param8 = "", string param9 = "")
+    {
+        if(logLevel < networkSync_LogLevel)
+            return;
+
+        TraderXLogEntry entry = Enqueue(format, logLevel);
+        entry.hasParams = true;
+        entry.param1 = param1;
+        entry.param2 = param2;
+        entry.param3 = param3;
+        entry.param4 = param4;
+        entry.param5 = param5;
+        entry.param6 = param6;
+        entry.param7 = param7;
+        entry.param8 = param8;
+        entry.param9 = param9;
+
+        if(logLevel == TraderXLogLevel.Error)
+            Flush();
+    }
+
+    private TraderXLogEntry Enqueue(string message, TraderXLogLevel logLevel)
+    {
+        if(!m_Buffer)
+            ResizeBuffer();
+
+        if(m_Buffer.IsFull())
+            Flush();
+
+        int hour, minute, second;
+        GetHourMinuteSecond(hour, minute, second);
+
+        TraderXLogEntry entry = m_Buffer.Acquire();
+        entry.secondOfDay = hour * 3600 + minute * 60 + second;
+        entry.logLevel = logLevel;
+        entry.message = message;
+        return entry;
+    }
+
+    /**
+     * Writes every buffered line in one batch, rotating the file when it grows past maxFileSizeKB
+     */
+    void Flush()
+    {
+        if(!m_Buffer || m_Buffer.Count() == 0)
+            return;
+
+        // Nothing to write to yet, lines stay buffered (oldest dropped once full)
+        if(fileHandle == 0)
+            return;
+
+        int maxFileBytes = GetSettings().maxFileSizeKB * 1024;
+        string batch = "";
+        for(int i = 0; i < m_Buffer.Count(); i++)
+        {
+            string line = m_Buffer.Get(i).Format() + "\n";
+            if(maxFileBytes > 0 && m_FileBytes + batch.Length() + line.Length() > maxFileBytes)
+            {
+                FPrint(fileHandle, batch);
+                batch = "";
+                RotateLogFile();
+                if(fileHandle == 0)
+                    break;
+            }
+            batch += line;
+        }
+
+        if(fileHandle != 0 && batch != "")
+        {
+            FPrint(fileHandle, batch);
+            m_FileBytes += batch.Length();
+        }
+
+        m_Buffer.Clear();
     }
 
     void LogInfo(string content)
@@ -166,7 +356,7 @@ class TraderXLoggingModule : CF_ModuleGame
         Log(content, TraderXLogLevel.Debug);
     }
 
-    string GetLogLevelString(TraderXLogLevel logLevel)
+    static string GetLogLevelString(TraderXLogLevel logLevel)
     {
         switch(logLevel)
         {
@@ -3,6 +3,14 @@ class TraderXLoggingSettings
     int logLevel = 0;
     int refreshRateInSeconds = 60;
 
+    // Lines are buffered in memory and written in batches
+    int bufferCapacity = 512;
+    float flushIntervalSeconds = 1.0;
+
+    // A log file is rotated once it reaches maxFileSizeKB, only the newest maxRotatedFiles of a session are kept
+    int maxFileSizeKB = 10240;
+    int maxRotatedFiles = 5;
+
     void MakeDirectoryIfNotExists()
     {
         if(!FileExist(TRADERX_CONFIG_ROOT_SERVER))
@@ -34,14 +34,14 @@ class ActionTraderXMenu: ActionInteractBase
         PlayerBase playerNpc = PlayerBase.Cast( target.GetObject() );
 		if(playerNpc && playerNpc.IsTraderNpc())
 		{
-			npc = GetTraderXModule().GetSettings().GetNpcById(playerNpc.GetNpcId());
+			npc = TraderXNpcTradeViewRepository.GetNpc(playerNpc.GetNpcId());
 			return npc != null;
 		}
 
 		BuildingBase nObject = BuildingBase.Cast( target.GetObject() );
 		if (nObject && nObject.IsTraderNpc())
 		{
-			npc = GetTraderXModule().GetSettings().GetNpcById(nObject.GetNpcId());
+			npc = TraderXNpcTradeViewRepository.GetNpc(nObject.GetNpcId());
 			return npc != null;
 		}
 
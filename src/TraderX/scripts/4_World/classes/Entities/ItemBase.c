@@ -0,0 +1,21 @@
+modded class ItemBase
+{
+	// Keeps the owner's TraderX wallet index current as items move in and out of the inventory
+	override void EEInventoryIn(Man newParentMan, EntityAI diz, EntityAI newParent)
+	{
+		super.EEInventoryIn(newParentMan, diz, newParent);
+
+		PlayerBase player;
+		if (GetGame().IsServer() && Class.CastTo(player, newParentMan))
+			player.OnTraderXItemInventoryIn(this);
+	}
+
+	override void EEInventoryOut(Man oldParentMan, EntityAI diz, EntityAI newParent)
+	{
+		super.EEInventoryOut(oldParentMan, diz, newParent);
+
+		PlayerBase player;
+		if (GetGame().IsServer() && Class.CastTo(player, oldParentMan))
+			player.OnTraderXItemInventoryOut(this);
+	}
+};
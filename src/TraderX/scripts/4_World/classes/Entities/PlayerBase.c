@@ -13,6 +13,9 @@ modded class PlayerBase extends ManBase
 {
 	int	netSync_playerId = 0;
 
+	// Server-side money index, created on the first balance check
+	protected ref TraderXPlayerWallet m_TraderXWallet;
+
 	override void Init()
 	{
 		super.Init();
@@ -67,6 +70,40 @@ modded class PlayerBase extends ManBase
 		//GetTraderXLogger().LogDebug(output);
 	}
 
+	//Wallet index
+	TraderXPlayerWallet GetTraderXWallet()
+	{
+		if (!m_TraderXWallet)
+			m_TraderXWallet = new TraderXPlayerWallet(this);
+
+		return m_TraderXWallet;
+	}
+
+	void OnTraderXItemInventoryIn(EntityAI item)
+	{
+		if (m_TraderXWallet)
+			m_TraderXWallet.OnItemEntered(item);
+	}
+
+	void OnTraderXItemInventoryOut(EntityAI item)
+	{
+		if (m_TraderXWallet)
+			m_TraderXWallet.OnItemExited(item);
+	}
+
+	void OnTraderXItemQuantityChanged(ItemBase item)
+	{
+		if (m_TraderXWallet)
+			m_TraderXWallet.OnItemQuantityChanged(item);
+	}
+
+	// Drops the money index, the next balance check enumerates the inventory again
+	void InvalidateTraderXWallet()
+	{
+		if (m_TraderXWallet)
+			m_TraderXWallet.Invalidate();
+	}
+
 	override void SetActions()
 	{
 		super.SetActions();
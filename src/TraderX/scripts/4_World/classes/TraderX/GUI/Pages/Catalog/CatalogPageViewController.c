@@ -46,6 +46,10 @@ class CatalogPageViewController: ViewController
     
     bool HasSellableProducts(TraderXCategory category)
     {
+        TraderXNpcTradeView npcView = TraderXNpcTradeViewRepository.GetView(TraderXTradingService.GetInstance().GetNpcId());
+        if (npcView && npcView.HasCategory(category.categoryId))
+            return npcView.HasSellableProducts(category.categoryId);
+
         array<ref TraderXProduct> products = category.GetProducts();
         foreach (TraderXProduct product : products)
         {
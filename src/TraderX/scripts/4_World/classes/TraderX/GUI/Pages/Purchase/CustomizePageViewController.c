@@ -48,11 +48,9 @@ class CustomizePageViewController: ViewController
         UnregisterEventHandlers();
         UnregisterServiceEvents();
         
-        if (preview)
-        {
-            GetGame().ObjectDelete(preview);
-            preview = null;
-        }
+        // The preview belongs to the preview service, handed back to the pool there
+        CustomizePreviewService.GetInstance().CleanupCurrentPreview();
+        preview = null;
         
         if (instance == this)
             instance = null;
@@ -292,11 +290,7 @@ class CustomizePageViewController: ViewController
             if(!attachment)
                 continue;
 
-            EntityAI entAttach = EntityAI.Cast(GetGame().CreateObjectEx(attachment.className, vector.Zero, ECE_LOCAL|ECE_NOLIFETIME));
-            if(!entAttach)
-                continue;
-
-            AttachToPreview(entAttach, attachment);
+            AttachToPreview(attachment);
         }
     }
 
@@ -364,10 +358,9 @@ class CustomizePageViewController: ViewController
         UpdateAttachmentList();
     }
 
-    void AttachToPreview(EntityAI entityAI, TraderXProduct tpItem)
+    void AttachToPreview(TraderXProduct tpItem)
     {
-        bool hasBeenAdded = TraderXAttachmentHandler.TryAttachItem(preview, entityAI);
-        if(hasBeenAdded)
+        if(TraderXAttachmentHandler.TryAttachClassName(preview, tpItem.className))
             itemAttachments.Insert(tpItem);
 
         UpdateAttachmentList();
@@ -402,14 +395,13 @@ class CustomizePageViewController: ViewController
         // Get current items from checkout instead of preview
         array<ref CheckoutCardView> checkoutItems = CheckoutViewController.GetInstance().GetCheckoutItems();
         
-        // Update UI selection states for all attachment cards
-        foreach(ItemCardView itemCardView : category_card_list.Get(0).GetTemplateController().item_card_list.GetArray())
+        // Update selection states for all attachments, cards not created yet pick them up when bound
+        foreach(TraderXProduct cardItem : category_card_list.Get(0).GetTemplateController().GetCardList().GetItems())
         {
-            if(!itemCardView)
+            if(!cardItem)
                 continue;
 
             bool isSelected = false;
-            TraderXProduct cardItem = itemCardView.GetTemplateController().GetItem();
             
             // Check if this card's item is in checkout list
             foreach(CheckoutCardView checkoutCard : checkoutItems)
@@ -426,7 +418,7 @@ class CustomizePageViewController: ViewController
             }
             
             // Update card selection state
-            itemCardView.GetTemplateController().SetItemSelected(isSelected);
+            ItemCardViewController.SetProductSelected(cardItem, isSelected);
         }
 
         // Update legacy itemAttachments for compatibility with checkout items
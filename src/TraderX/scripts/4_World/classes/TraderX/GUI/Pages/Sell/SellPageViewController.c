@@ -4,6 +4,10 @@ class SellPageViewController: ViewController
 
     ref ObservableCollection<ref ItemCardView> item_card_list = new ObservableCollection<ref ItemCardView>(this);
 
+    // Creates only the cards in view, see ItemCardVirtualList
+    ref ItemCardViewList cardList;
+    Widget itemCardGrid;
+
     ref map<int, ref array<ref TraderXProduct>> mPlayerItemsPerSlotId = new map<int, ref array<ref TraderXProduct>>();
 
     ref array<ref TraderXProduct> playerItemsFromSelectedNav = new array<ref TraderXProduct>();
@@ -76,19 +80,27 @@ class SellPageViewController: ViewController
         NotifyPropertiesChanged({"entire_container_sell", "selected_item_sell", "manual_sell"}, false);
     }
 
+    ItemCardViewList GetCardList()
+    {
+        if(!cardList)
+            cardList = new ItemCardViewList(itemCardGrid, item_card_list, EItemCardSize.LARGE, ETraderXCategoryType.NONE, true, false);
+
+        return cardList;
+    }
+
     void UnSelectAllItems() 
     {
-        for(int i = 0; i < item_card_list.GetArray().Count(); i++)
+        foreach(TraderXProduct item: GetCardList().GetItems())
         {
-            item_card_list.Get(i).GetTemplateController().SetItemSelected(false);
+            ItemCardViewController.SetProductSelected(item, false);
         }
     }
 
     void SelectAllItems()
     {
-        for(int i = 0; i < item_card_list.GetArray().Count(); i++)
+        foreach(TraderXProduct item: GetCardList().GetItems())
         {
-            item_card_list.Get(i).GetTemplateController().SetItemSelected(true);
+            ItemCardViewController.SetProductSelected(item, true);
         }
     }
 
@@ -191,17 +203,27 @@ class SellPageViewController: ViewController
     void FillItemCardList()
     {
         GetTraderXLogger().LogDebug("FillItemCardList");
-        item_card_list.Clear();
+        array<ref TraderXProduct> items = new array<ref TraderXProduct>();
         foreach(TraderXProduct item: playerItemsFromSelectedNav)
         {
-            if(!item)
+            if(!item || !MatchesSearch(item))
                 continue;
 
-            item_card_list.Insert(new ItemCardView(item, EItemCardSize.LARGE, true, false));
+            items.Insert(item);
         }
 
-        if(search_keyword != string.Empty)
-            FilterItemList();
+        GetCardList().SetItems(items);
+    }
+
+    bool MatchesSearch(TraderXProduct item)
+    {
+        return search_keyword == string.Empty || item.className.Contains(search_keyword) || item.GetDisplayName().Contains(search_keyword);
+    }
+
+    // Sell cards are only selectable while the trader has room for the product
+    bool CanSelectItem(TraderXProduct item)
+    {
+        return !TraderXProductStockRepository.IsStockReached(item.productId, item.maxStock);
     }
 
     void OnPlayerSlotEventClick(PlayerSlotNavigationButtonViewController buttonViewController, int command = ETraderXClickEvents.LCLICK)
@@ -238,7 +260,7 @@ class SellPageViewController: ViewController
                 return;
 
             if(selectedNavBtn.navBtnId == buttonViewController.navBtnId){
-                item_card_list.Clear();
+                GetCardList().Clear();
                 return;
             }
 
@@ -297,14 +319,10 @@ class SellPageViewController: ViewController
         if(!selected_item_sell)
             return;
 
-        for(int i = 0; i < item_card_list.GetArray().Count(); i++)
+        foreach(TraderXProduct item: GetCardList().GetItems())
         {
-            ItemCardViewController itemCard = item_card_list.Get(i).GetTemplateController();
-            if(!itemCard)
-                continue;
-
-            if(itemCard.preview.GetType() == itemSelected.preview.GetType())
-                itemCard.SetItemSelected(true);
+            if(item.className == itemSelected.item.className)
+                ItemCardViewController.SetProductSelected(item, true);
         }
     }   
 
@@ -343,14 +361,14 @@ class SellPageViewController: ViewController
 
         itemShiftLClicked.SetItemSelected(true);
 
-        for(int i = 0; i < item_card_list.GetArray().Count(); i++)
+        foreach(TraderXProduct item: GetCardList().GetItems())
         {
-            ItemCardViewController itemCard = item_card_list.Get(i).GetTemplateController();
-            if(!itemCard)
+            if(!item.playerItem || !CanSelectItem(item))
                 continue;
 
-            if(entityItems.Find(itemCard.preview) != -1 && itemCard.selectable)
-                itemCard.SetItemSelected(true);
+            EntityAI entity = EntityAI.Cast(GetGame().GetObjectByNetworkId(item.playerItem.networkIdLow, item.playerItem.networkIdHigh));
+            if(entity && entityItems.Find(entity) != -1)
+                ItemCardViewController.SetProductSelected(item, true);
         }
     }
 
@@ -382,9 +400,10 @@ class SellPageViewController: ViewController
     { 
         if(responseReceived == ETraderXResponse.ALL_STOCK_RECEIVED)
         { 
-            for(int i = 0; i < item_card_list.GetArray().Count(); i++)
+            // Only the cards created so far, the others read the stock when they are bound
+            for(int i = 0; i < GetCardList().GetCardCount(); i++)
             {
-                ItemCardViewController itemCardViewController = item_card_list.Get(i).GetTemplateController();
+                ItemCardViewController itemCardViewController = GetCardList().GetCard(i).GetTemplateController();
                 itemCardViewController.UpdateStock();                
             }
         }
@@ -398,28 +417,15 @@ class SellPageViewController: ViewController
 
     void Refresh()
     {
-        item_card_list.Clear();
+        GetCardList().Clear();
         CheckoutViewController.GetInstance().UpdateCheckoutView();
         InitPlayerItems();
         OnPlayerSlotEventClick(PlayerSlotNavigationViewController.GetNavigationInstance().GetSelectedNavBtn());
     }
 
-    void FilterItemList()
-    {
-        for(int i = 0; i < item_card_list.GetArray().Count(); i++)
-        {
-            TraderXProduct item = item_card_list.Get(i).GetTemplateController().item;
-            if(item.className.Contains(search_keyword) || item.GetDisplayName().Contains(search_keyword) || search_keyword == string.Empty){
-                item_card_list.Get(i).Show(true);
-            }else{
-                item_card_list.Get(i).Show(false);
-            }
-        }
-    }
-
     void DebouncedSearch()
     {
-        FilterItemList();
+        FillItemCardList();
     }
 
     override void PropertyChanged(string property_name)
@@ -20,6 +20,9 @@ class CatalogCategoryCardViewController: ViewController
     bool isBlocked = false;
 
     ref TraderXCategory category;
+
+    // Creates only the cards in view, see ItemCardVirtualList
+    ref CatalogItemCardViewList cardList;
     string searchKeyword;
 
     void SetCategoryCardData(TraderXCategory category, int itemCardViewSize, bool expand = false, int categoryType = ETraderXCategoryType.NONE)
@@ -28,6 +31,7 @@ class CatalogCategoryCardViewController: ViewController
         this.category = category;
         this.itemCardViewSize = itemCardViewSize;
         this.categoryType = categoryType;
+        cardList = new CatalogItemCardViewList(itemCardGrid, catalog_item_card_list, categoryType);
 
         category_name = category.categoryName;
         item_count = category.productIds.Count().ToString() + " items";
@@ -73,7 +77,7 @@ class CatalogCategoryCardViewController: ViewController
         itemCountText.Show(isExpanded);
 
         if (isExpanded){
-            catalog_item_card_list.Clear();
+            cardList.Clear();
         }
         else{
             ShowItemList();
@@ -94,7 +98,7 @@ class CatalogCategoryCardViewController: ViewController
         itemCountText.Show(isExpanded);
 
         if (isExpanded){
-            catalog_item_card_list.Clear();
+            cardList.Clear();
         }
         else{
             ShowItemList();
@@ -122,37 +126,13 @@ class CatalogCategoryCardViewController: ViewController
 
     void Sort(bool ascending)
     {
-        bool isSwapped = true;
-        int n = catalog_item_card_list.GetArray().Count();
-
-        while(isSwapped)
-        {
-            isSwapped = false;
-            for (int i = 1; i < n; i++)
-            {
-                CatalogItemCardView a = catalog_item_card_list.Get(i - 1);
-                CatalogItemCardView b = catalog_item_card_list.Get(i);
-
-                int aProperty = a.GetTemplateController().GetPrice();
-                int bProperty = b.GetTemplateController().GetPrice();
-
-                if(ascending && aProperty > bProperty)
-                {
-                    catalog_item_card_list.SwapItems(i - 1, i);
-                    isSwapped = true;
-                }else if (aProperty < bProperty){
-                    catalog_item_card_list.SwapItems(i - 1, i);
-                    isSwapped = true;
-                }
-            }
-            n--;
-        }
+        cardList.SortByPrice(ascending);
     }
 
     void FilterList(string searchKeyword)
     {
         this.searchKeyword = searchKeyword;
-        catalog_item_card_list.Clear();
+        array<ref TraderXProduct> items = new array<ref TraderXProduct>();
         string searchLower = searchKeyword;
         searchLower.ToLower();
         array<ref TraderXProduct> products = category.GetProducts();
@@ -166,9 +146,10 @@ class CatalogCategoryCardViewController: ViewController
             string displayNameLower = item.GetDisplayName();
             displayNameLower.ToLower();
             if(searchLower == string.Empty || classNameLower.Contains(searchLower) || displayNameLower.Contains(searchLower)){
-                catalog_item_card_list.Insert(new CatalogItemCardView(item, categoryType));
+                items.Insert(item);
             }
         }
+        cardList.SetItems(items);
     }
 
     bool OnCollapseClic(ButtonCommandArgs args)
@@ -180,15 +161,21 @@ class CatalogCategoryCardViewController: ViewController
 
     void ShowItemList()
     {
-        catalog_item_card_list.Clear();
+        array<ref TraderXProduct> items = new array<ref TraderXProduct>();
         array<ref TraderXProduct> products = category.GetProducts();
         foreach(TraderXProduct item : products)
         {
             if(!item.CanBeSold())
                 continue;
                 
-            catalog_item_card_list.Insert(new CatalogItemCardView(item, categoryType));
+            items.Insert(item);
         }
+        cardList.SetItems(items);
+    }
+
+    CatalogItemCardViewList GetCardList()
+    {
+        return cardList;
     }
 }
 
@@ -21,12 +21,16 @@ class CategoryCardViewController: ViewController
 
     ref TraderXCategory category;
 
+    // Creates only the cards in view, see ItemCardVirtualList
+    ref ItemCardViewList cardList;
+
     void SetCategoryCardData(TraderXCategory category, int itemCardViewSize, bool expand = false, int categoryType = ETraderXCategoryType.NONE)
     {
         GetTraderXLogger().LogDebug("SetCategoryCardData " + category.categoryName + " expand: " + expand); 
         this.category = category;
 		this.itemCardViewSize = itemCardViewSize;
         this.categoryType = categoryType;
+        cardList = new ItemCardViewList(itemCardGrid, item_card_list, itemCardViewSize, categoryType);
 
         category_name = category.categoryName;
         item_count = category.productIds.Count().ToString() + " items";
@@ -72,7 +76,7 @@ class CategoryCardViewController: ViewController
         itemCountText.Show(isExpanded);
 
         if (isExpanded){
-            item_card_list.Clear();
+            cardList.Clear();
         }
         else{
             ShowItemList();
@@ -93,7 +97,7 @@ class CategoryCardViewController: ViewController
         itemCountText.Show(isExpanded);
 
         if (isExpanded){
-            item_card_list.Clear();
+            cardList.Clear();
         }
         else{
             ShowItemList();
@@ -121,36 +125,12 @@ class CategoryCardViewController: ViewController
 
     void Sort(bool ascending)
     {
-        bool isSwapped = true;
-        int n = item_card_list.GetArray().Count();
-
-        while(isSwapped)
-        {
-            isSwapped = false;
-            for (int i = 1; i < n; i++)
-            {
-                ItemCardView a = item_card_list.Get(i - 1);
-                ItemCardView b = item_card_list.Get(i);
-
-                int aProperty = a.GetTemplateController().GetPrice();
-                int bProperty = b.GetTemplateController().GetPrice();
-
-                if(ascending && aProperty > bProperty)
-                {
-                    item_card_list.SwapItems(i - 1, i);
-                    isSwapped = true;
-                }else if (aProperty < bProperty){
-                    item_card_list.SwapItems(i - 1, i);
-                    isSwapped = true;
-                }
-            }
-            n--;
-        }
+        cardList.SortByPrice(ascending);
     }
 
     void FilterList(string searchKeyword)
     {
-        item_card_list.Clear();
+        array<ref TraderXProduct> items = new array<ref TraderXProduct>();
         string searchLower = searchKeyword;
         searchLower.ToLower();
         array<ref TraderXProduct> products = category.GetProducts();
@@ -164,9 +144,10 @@ class CategoryCardViewController: ViewController
             string displayNameLower = item.GetDisplayName();
             displayNameLower.ToLower();
             if(classNameLower.Contains(searchLower) || displayNameLower.Contains(searchLower)){
-                item_card_list.Insert(ItemCardView.CreateItemCardView(item, itemCardViewSize, categoryType));
+                items.Insert(item);
             }
         }
+        cardList.SetItems(items);
     }
 
     bool OnCollapseClic(ButtonCommandArgs args)
@@ -178,14 +159,20 @@ class CategoryCardViewController: ViewController
 
     void ShowItemList()
     {
-        item_card_list.Clear();
+        array<ref TraderXProduct> items = new array<ref TraderXProduct>();
         array<ref TraderXProduct> products = category.GetProducts();
         foreach(TraderXProduct item : products)
         {
             if(!item.CanBeBought())
                 continue;
                 
-            item_card_list.Insert(ItemCardView.CreateItemCardView(item, itemCardViewSize, categoryType));
+            items.Insert(item);
         }
+        cardList.SetItems(items);
+    }
+
+    ItemCardViewList GetCardList()
+    {
+        return cardList;
     }
 }
\ No newline at end of file
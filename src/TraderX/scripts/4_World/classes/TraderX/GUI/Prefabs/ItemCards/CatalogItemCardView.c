@@ -16,6 +16,11 @@ class CatalogItemCardViewController: ViewController
         TraderXTradingService.Event_OnTraderXResponseReceived.Insert(OnTraderXResponseReceived);
     }
 
+    void ~CatalogItemCardViewController()
+    {
+        ReleasePreview();
+    }
+
     void Setup(TraderXProduct item, int categoryType, bool selectable = false, bool isFavable = false, bool isFav = false)
     {
         this.item = item;
@@ -30,6 +35,13 @@ class CatalogItemCardViewController: ViewController
         OnShow(true);
     }
 
+    // Point a card recycled by ItemCardVirtualList at another product
+    void Rebind(TraderXProduct newItem)
+    {
+        ReleasePreview();
+        Setup(newItem, categoryType);
+    }
+
     void ShowName()
     {
         itemName = item.GetDisplayName();
@@ -48,12 +60,11 @@ class CatalogItemCardViewController: ViewController
 
     void CreatePreview()
     {
-        // Always create preview from className for catalog items (no player item needed)
-        preview = EntityAI.Cast(GetGame().CreateObjectEx(item.className, vector.Zero, ECE_LOCAL|ECE_NOLIFETIME));
-        
         // Apply default preset if available
         LookForDefaultPreset();
-        CreateAttachments();
+
+        // Always preview from className for catalog items (no player item needed), pooled with its attachments
+        preview = TraderXPreviewEntityPool.GetInstance().Acquire(item.className, ItemCardViewController.GetAttachmentClassNames(item.selectedAttachments));
 
         NotifyPropertyChanged("preview");
     }
@@ -73,21 +84,16 @@ class CatalogItemCardViewController: ViewController
 
     void CreateAttachments()
     {
-        if(!item || !item.selectedAttachments)
+        if(!item || !item.selectedAttachments || !preview)
             return;
 
-        foreach(string productId: item.selectedAttachments)
-        {
-            TraderXProduct attachment = TraderXProductRepository.GetItemById(productId);
-            if(!attachment)
-                continue;
-
-            EntityAI entAttach = EntityAI.Cast(GetGame().CreateObjectEx(attachment.className, vector.Zero, ECE_LOCAL|ECE_NOLIFETIME));
-            if(!entAttach)
-                continue;
+        TraderXPreviewEntityPool.ResetAttachments(preview, ItemCardViewController.GetAttachmentClassNames(item.selectedAttachments));
+    }
 
-            TraderXAttachmentHandler.TryAttachItem(preview, entAttach);
-        }
+    void ReleasePreview()
+    {
+        TraderXPreviewEntityPool.GetInstance().Release(preview);
+        preview = null;
     }
 
     string GetSellPrice()
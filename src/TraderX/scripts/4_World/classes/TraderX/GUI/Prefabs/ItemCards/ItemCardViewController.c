@@ -4,9 +4,13 @@ class ItemCardViewController: ViewController
     string itemName, itemPrice, itemStock;
     float itemVolume;
     EntityAI preview;
+    bool ownsPreview;
     int tradeMode;
     int categoryType;
     bool selectable, isFavable, isFav;
+    bool baseSelectable;
+    int stockIdleColor;
+    bool stockIdleColorSaved;
     Widget itemCardOutline, itemCardContent, stockText;
 	ImageWidget selectedIcon, unselectedIcon, favIcon, unfavIcon, healthImg;
     Widget volumeBar, favBtn;
@@ -38,6 +42,7 @@ class ItemCardViewController: ViewController
     {
         Event_OnDestroyAllTooltips.Remove(DestroyTooltips);
         DestroyTooltips();
+        ReleasePreview();
     }
 
     static void DestroyAllTooltips()
@@ -51,8 +56,14 @@ class ItemCardViewController: ViewController
         this.tradeMode = TraderXTradingService.GetInstance().GetTradeMode();
         this.categoryType = categoryType;
         this.selectable = selectable;
+        this.baseSelectable = selectable;
         this.isFavable = isFavable;
 
+        if(!stockIdleColorSaved){
+            stockIdleColor = stockText.GetColor();
+            stockIdleColorSaved = true;
+        }
+
         if(isFavable){
             this.isFav = TraderXFavoritesService.GetInstance().IsFavorite(item);
             UpdateFav();
@@ -77,6 +88,16 @@ class ItemCardViewController: ViewController
         OnShow(true);
     }
 
+    // Point a card recycled by ItemCardVirtualList at another product
+    void Rebind(TraderXProduct newItem)
+    {
+        DestroyTooltips();
+        ReleasePreview();
+        quantityStr = string.Empty;
+        stockText.SetColor(stockIdleColor);
+        Setup(newItem, categoryType, baseSelectable, isFavable, false);
+    }
+
     void ShowName()
     {
         itemName = item.GetDisplayName();
@@ -94,6 +115,7 @@ class ItemCardViewController: ViewController
             return;
         }
         else{
+            stockText.Show(true);
             GetTraderXLogger().LogDebug("UpdateStock - Product: " + item.productId + " maxStock: " + item.maxStock);
         }
 
@@ -143,18 +165,19 @@ class ItemCardViewController: ViewController
     {
         if(tradeMode == ETraderXTradeMode.SELL){
             preview = GetGame().GetObjectByNetworkId(item.playerItem.networkIdLow, item.playerItem.networkIdHigh);
-            if(!preview)
-                preview = EntityAI.Cast(GetGame().CreateObjectEx(item.className, vector.Zero, ECE_LOCAL|ECE_NOLIFETIME));
+            if(!preview){
+                preview = TraderXPreviewEntityPool.GetInstance().Acquire(item.className, new TStringArray());
+                ownsPreview = true;
+            }
         }
         else
         {
-            preview = EntityAI.Cast(GetGame().CreateObjectEx(item.className, vector.Zero, ECE_LOCAL|ECE_NOLIFETIME));
-            
             // Check for default preset and apply it
             LookForDefaultPreset();
-            
-            // Create attachments (either from preset or selected attachments)
-            CreateAttachments();
+
+            // Pooled preview, comes back with the preset or selected attachments already in place
+            preview = TraderXPreviewEntityPool.GetInstance().Acquire(item.className, GetAttachmentClassNames(item.selectedAttachments));
+            ownsPreview = true;
         }
 
         NotifyPropertyChanged("preview");
@@ -179,21 +202,35 @@ class ItemCardViewController: ViewController
 
     void CreateAttachments()
     {
-        if(!item|| item && !item.selectedAttachments)
+        if(!item|| item && !item.selectedAttachments || !preview || !ownsPreview)
             return;
 
-        foreach(string productId: item.selectedAttachments)
+        TraderXPreviewEntityPool.ResetAttachments(preview, GetAttachmentClassNames(item.selectedAttachments));
+    }
+
+    static TStringArray GetAttachmentClassNames(TStringArray attachmentIds)
+    {
+        TStringArray classNames = new TStringArray();
+        if(!attachmentIds)
+            return classNames;
+
+        foreach(string productId: attachmentIds)
         {
             TraderXProduct attachment = TraderXProductRepository.GetItemById(productId);
-            if(!attachment)
-                continue;
+            if(attachment)
+                classNames.Insert(attachment.className);
+        }
+        return classNames;
+    }
 
-            EntityAI entAttach = EntityAI.Cast(GetGame().CreateObjectEx(attachment.className, vector.Zero, ECE_LOCAL|ECE_NOLIFETIME));
-            if(!entAttach)
-                continue;
+    // Hands the preview back to the pool only when the card took it from there, never the player's own item
+    void ReleasePreview()
+    {
+        if(preview && ownsPreview)
+            TraderXPreviewEntityPool.GetInstance().Release(preview);
 
-            TraderXAttachmentHandler.TryAttachItem(preview, entAttach);
-        }
+        preview = null;
+        ownsPreview = false;
     }
 
     EntityAI GetPreview()
@@ -208,48 +245,57 @@ class ItemCardViewController: ViewController
 
     string GetPriceFromItem()
     {
-        if(tradeMode == ETraderXTradeMode.SELL){
-            if(item.GetPlayerItem()){
+        if(tradeMode != ETraderXTradeMode.SELL && tradeMode != ETraderXTradeMode.BUY)
+            return string.Empty;
+
+        return GetListPrice(item, tradeMode).ToString();
+    }
+
+    // Price shown on the card for a product, also used to sort products that have no card yet
+    static int GetListPrice(TraderXProduct product, int mode)
+    {
+        if(mode == ETraderXTradeMode.SELL){
+            if(product.GetPlayerItem()){
                 // Use dynamic sell pricing based on current stock and coefficient
-                int dynamicPrice = TraderXPricingService.GetInstance().GetPricePreview(item.GetProductId(), false, 1, item.GetPlayerItem().healthLevel);
-                return dynamicPrice.ToString();
-            } else {
-                // Catalog item - calculate theoretical sell price based on pristine condition
-                int catalogSellPrice = TraderXPricingService.GetInstance().GetPricePreview(item.GetProductId(), false, 1, TraderXItemState.PRISTINE);
-                return catalogSellPrice.ToString();
+                return TraderXPricingService.GetInstance().GetPricePreview(product.GetProductId(), false, 1, product.GetPlayerItem().healthLevel);
             }
+
+            // Catalog item - calculate theoretical sell price based on pristine condition
+            return TraderXPricingService.GetInstance().GetPricePreview(product.GetProductId(), false, 1, TraderXItemState.PRISTINE);
         }
 
-        if(tradeMode == ETraderXTradeMode.BUY){
-            // Use dynamic buy pricing based on current stock and coefficient
-            int basePrice = TraderXPricingService.GetInstance().GetPricePreview(item.GetProductId(), true, 1, TraderXItemState.PRISTINE);
-            
-            // Add preset price if default preset is applied
-            if(item.defaultPreset)
-            {
-                int presetPrice = TraderXPresetsService.GetInstance().CalculateTotalPricePreset(item.defaultPreset);
-                basePrice = presetPrice;
-            }
-            else
-            {
-                // Fallback to individual attachment pricing
-                basePrice += CalculateAttachmentsPrice();
-            }
-            
-            return basePrice.ToString();
+        if(mode == ETraderXTradeMode.BUY){
+            // Preset price if default preset is applied
+            TraderXPreset defaultPreset = product.defaultPreset;
+            if(!defaultPreset)
+                defaultPreset = TraderXPresetsService.GetInstance().GetDefaultPreset(product.productId);
+            if(!defaultPreset)
+                defaultPreset = TraderXPresetsService.GetInstance().GetServerDefaultPreset(product.productId);
+
+            if(defaultPreset)
+                return TraderXPresetsService.GetInstance().CalculateTotalPricePreset(defaultPreset);
+
+            // Use dynamic buy pricing based on current stock and coefficient, plus individual attachment pricing
+            int basePrice = TraderXPricingService.GetInstance().GetPricePreview(product.GetProductId(), true, 1, TraderXItemState.PRISTINE);
+            return basePrice + GetAttachmentsPrice(product);
         }
 
-        return string.Empty;
+        return 0;
     }
 
     int CalculateAttachmentsPrice()
+    {
+        return GetAttachmentsPrice(item);
+    }
+
+    static int GetAttachmentsPrice(TraderXProduct product)
     {
         int price = 0;
 
-        if(!item.selectedAttachments)
+        if(!product.selectedAttachments)
             return price;
             
-        foreach(UUID productId: item.selectedAttachments)
+        foreach(UUID productId: product.selectedAttachments)
         {
             TraderXProduct attachment = TraderXProductRepository.GetItemById(productId);
             if(!attachment)
@@ -537,16 +583,22 @@ class ItemCardViewController: ViewController
     }
 
     void SetItemSelected(bool selected)
+    {
+        SetProductSelected(item, selected);
+    }
+
+    // Selection lives on the product, so products without a card can be selected too
+    static void SetProductSelected(TraderXProduct product, bool selected)
     {
         TraderXSelectionService selectionService = TraderXSelectionService.GetInstance();
         
         if (selected)
         {
-            selectionService.SelectItem(item);
+            selectionService.SelectItem(product);
         }
         else
         {
-            selectionService.DeselectItem(item);
+            selectionService.DeselectItem(product);
         }
     }
 
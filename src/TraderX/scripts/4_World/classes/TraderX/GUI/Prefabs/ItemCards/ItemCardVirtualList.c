@@ -0,0 +1,355 @@
+/**
+ * ItemCardVirtualList - Item card grid that only creates the cards that can be seen
+ * The list holds every product but only creates cards row by row while the end of the grid is
+ * inside the scroll viewport plus OVERSCAN_ROWS. Refilling, filtering or sorting rebinds the
+ * cards already created to the new products instead of destroying and recreating them.
+ * Subclasses own the ObservableCollection and know how to create and bind their card type.
+ */
+class ItemCardVirtualList
+{
+    // Matches the Columns of the itemCardGrid spacers
+    static const int GRID_COLUMNS = 6;
+    static const int INITIAL_ROWS = 2;
+    static const int OVERSCAN_ROWS = 1;
+    static const int UPDATE_INTERVAL_MS = 100;
+
+    protected ref array<ref TraderXProduct> m_Items;
+    protected Widget m_Grid;
+    protected ScrollWidget m_Scroll;
+    protected bool m_IsUpdating;
+
+    void ItemCardVirtualList()
+    {
+        m_Items = new array<ref TraderXProduct>();
+    }
+
+    void ~ItemCardVirtualList()
+    {
+        StopUpdate();
+    }
+
+    // Replace the products shown, cards already created are reused
+    void SetItems(array<ref TraderXProduct> items)
+    {
+        m_Items.Clear();
+        if (items)
+        {
+            foreach (TraderXProduct item : items)
+            {
+                if (item)
+                    m_Items.Insert(item);
+            }
+        }
+
+        while (GetCardCount() > m_Items.Count())
+        {
+            RemoveCard(GetCardCount() - 1);
+        }
+
+        RebindCards();
+        Fill();
+    }
+
+    void Clear()
+    {
+        SetItems(null);
+    }
+
+    // Every product of the list, including those without a card yet
+    array<ref TraderXProduct> GetItems()
+    {
+        return m_Items;
+    }
+
+    int Count()
+    {
+        return m_Items.Count();
+    }
+
+    void SortByPrice(bool ascending)
+    {
+        // Same product can be listed twice with different prices, so prices follow the rows
+        TIntArray prices = new TIntArray();
+        foreach (TraderXProduct product : m_Items)
+        {
+            prices.Insert(GetItemPrice(product));
+        }
+
+        // Insertion sort, stable so equal prices keep the catalog order
+        for (int i = 1; i < m_Items.Count(); i++)
+        {
+            TraderXProduct current = m_Items[i];
+            int price = prices[i];
+            int j = i - 1;
+            while (j >= 0 && IsBefore(price, prices[j], ascending))
+            {
+                m_Items[j + 1] = m_Items[j];
+                prices[j + 1] = prices[j];
+                j--;
+            }
+            m_Items[j + 1] = current;
+            prices[j + 1] = price;
+        }
+
+        RebindCards();
+    }
+
+    protected bool IsBefore(int price, int otherPrice, bool ascending)
+    {
+        if (ascending)
+            return price < otherPrice;
+
+        return price > otherPrice;
+    }
+
+    protected void RebindCards()
+    {
+        for (int i = 0; i < GetCardCount(); i++)
+        {
+            if (GetCardItem(i) != m_Items[i])
+                BindCard(i, m_Items[i]);
+        }
+    }
+
+    // Create cards until the end of the grid is past the bottom of the viewport
+    protected void Fill()
+    {
+        if (GetCardCount() == 0)
+            AddRows(INITIAL_ROWS);
+
+        while (GetCardCount() < m_Items.Count() && NeedsMoreRows())
+        {
+            AddRows(1);
+        }
+
+        if (GetCardCount() < m_Items.Count())
+            StartUpdate();
+        else
+            StopUpdate();
+    }
+
+    protected void AddRows(int rows)
+    {
+        int target = GetCardCount() + rows * GRID_COLUMNS;
+        if (target > m_Items.Count())
+            target = m_Items.Count();
+
+        while (GetCardCount() < target)
+        {
+            CreateCard(m_Items[GetCardCount()]);
+        }
+
+        if (m_Grid)
+            m_Grid.Update();
+    }
+
+    protected bool NeedsMoreRows()
+    {
+        if (!m_Grid || !m_Grid.IsVisibleHierarchy() || GetCardCount() == 0)
+            return false;
+
+        Widget lastCard = GetCardRoot(GetCardCount() - 1);
+        if (!lastCard)
+            return false;
+
+        float cardX, cardY, cardWidth, cardHeight;
+        lastCard.GetScreenPos(cardX, cardY);
+        lastCard.GetScreenSize(cardWidth, cardHeight);
+
+        // Not laid out yet, measured again on the next update
+        if (cardHeight <= 0)
+            return false;
+
+        return cardY + cardHeight < GetViewportBottom() + OVERSCAN_ROWS * cardHeight;
+    }
+
+    protected float GetViewportBottom()
+    {
+        if (!m_Scroll)
+            m_Scroll = FindScroll();
+
+        if (m_Scroll)
+        {
+            float scrollX, scrollY, scrollWidth, scrollHeight;
+            m_Scroll.GetScreenPos(scrollX, scrollY);
+            m_Scroll.GetScreenSize(scrollWidth, scrollHeight);
+            return scrollY + scrollHeight;
+        }
+
+        int screenWidth, screenHeight;
+        GetScreenSize(screenWidth, screenHeight);
+        return screenHeight;
+    }
+
+    protected ScrollWidget FindScroll()
+    {
+        Widget parent = m_Grid.GetParent();
+        while (parent)
+        {
+            ScrollWidget scroll = ScrollWidget.Cast(parent);
+            if (scroll)
+                return scroll;
+
+            parent = parent.GetParent();
+        }
+        return null;
+    }
+
+    protected void Update()
+    {
+        Fill();
+    }
+
+    protected void StartUpdate()
+    {
+        if (m_IsUpdating)
+            return;
+
+        m_IsUpdating = true;
+        GetGame().GetCallQueue(CALL_CATEGORY_GUI).CallLater(Update, UPDATE_INTERVAL_MS, true);
+    }
+
+    protected void StopUpdate()
+    {
+        if (!m_IsUpdating)
+            return;
+
+        m_IsUpdating = false;
+        GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(Update);
+    }
+
+    // Card type specific, implemented by the subclasses
+    int GetCardCount()
+    {
+        return 0;
+    }
+
+    void CreateCard(TraderXProduct item) {}
+    void BindCard(int index, TraderXProduct item) {}
+    void RemoveCard(int index) {}
+
+    TraderXProduct GetCardItem(int index)
+    {
+        return null;
+    }
+
+    Widget GetCardRoot(int index)
+    {
+        return null;
+    }
+
+    int GetItemPrice(TraderXProduct item)
+    {
+        return 0;
+    }
+}
+
+// Buy, sell and favorites lists
+class ItemCardViewList : ItemCardVirtualList
+{
+    protected ObservableCollection<ref ItemCardView> m_Cards;
+    protected int m_CardSize;
+    protected int m_CategoryType;
+    protected bool m_Selectable;
+    protected bool m_IsFavable;
+
+    void ItemCardViewList(Widget grid, ObservableCollection<ref ItemCardView> cards, int cardSize, int categoryType = ETraderXCategoryType.NONE, bool selectable = true, bool isFavable = true)
+    {
+        m_Grid = grid;
+        m_Cards = cards;
+        m_CardSize = cardSize;
+        m_CategoryType = categoryType;
+        m_Selectable = selectable;
+        m_IsFavable = isFavable;
+    }
+
+    // Cards created so far, a prefix of GetItems()
+    ItemCardView GetCard(int index)
+    {
+        return m_Cards.Get(index);
+    }
+
+    override int GetCardCount()
+    {
+        return m_Cards.Count();
+    }
+
+    override void CreateCard(TraderXProduct item)
+    {
+        m_Cards.Insert(ItemCardView.CreateItemCardView(item, m_CardSize, m_CategoryType, m_Selectable, m_IsFavable));
+    }
+
+    override void BindCard(int index, TraderXProduct item)
+    {
+        m_Cards.Get(index).GetTemplateController().Rebind(item);
+    }
+
+    override void RemoveCard(int index)
+    {
+        m_Cards.Remove(index);
+    }
+
+    override TraderXProduct GetCardItem(int index)
+    {
+        return m_Cards.Get(index).GetTemplateController().GetItem();
+    }
+
+    override Widget GetCardRoot(int index)
+    {
+        return m_Cards.Get(index).GetLayoutRoot();
+    }
+
+    override int GetItemPrice(TraderXProduct item)
+    {
+        return ItemCardViewController.GetListPrice(item, TraderXTradingService.GetInstance().GetTradeMode());
+    }
+}
+
+// Catalog page lists
+class CatalogItemCardViewList : ItemCardVirtualList
+{
+    protected ObservableCollection<ref CatalogItemCardView> m_Cards;
+    protected int m_CategoryType;
+
+    void CatalogItemCardViewList(Widget grid, ObservableCollection<ref CatalogItemCardView> cards, int categoryType = ETraderXCategoryType.NONE)
+    {
+        m_Grid = grid;
+        m_Cards = cards;
+        m_CategoryType = categoryType;
+    }
+
+    override int GetCardCount()
+    {
+        return m_Cards.Count();
+    }
+
+    override void CreateCard(TraderXProduct item)
+    {
+        m_Cards.Insert(new CatalogItemCardView(item, m_CategoryType));
+    }
+
+    override void BindCard(int index, TraderXProduct item)
+    {
+        m_Cards.Get(index).GetTemplateController().Rebind(item);
+    }
+
+    override void RemoveCard(int index)
+    {
+        m_Cards.Remove(index);
+    }
+
+    override TraderXProduct GetCardItem(int index)
+    {
+        return m_Cards.Get(index).GetTemplateController().GetItem();
+    }
+
+    override Widget GetCardRoot(int index)
+    {
+        return m_Cards.Get(index).GetLayoutRoot();
+    }
+
+    override int GetItemPrice(TraderXProduct item)
+    {
+        return TraderXPricingService.GetInstance().GetPricePreview(item.GetProductId(), false, 1, TraderXItemState.PRISTINE);
+    }
+}
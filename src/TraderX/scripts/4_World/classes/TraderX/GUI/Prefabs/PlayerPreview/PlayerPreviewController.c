@@ -23,8 +23,7 @@ class PlayerPreviewController: ViewController
 
     void ~PlayerPreviewController()
     {
-        if (entPlayerPreview)
-            GetGame().ObjectDelete(entPlayerPreview);
+        TraderXPreviewEntityPool.GetInstance().Release(entPlayerPreview);
             
         TraderXSelectionService.GetInstance().Event_OnItemSelectionChanged.Remove(OnItemSelectionChanged);
     }
@@ -43,14 +42,13 @@ class PlayerPreviewController: ViewController
 
     protected void CreatePreviewCharacter()
     {
-        if (entPlayerPreview)
-            GetGame().ObjectDelete(entPlayerPreview);
+        TraderXPreviewEntityPool.GetInstance().Release(entPlayerPreview);
 
-        //Create preview character at a safe position
+        //Take the preview character at a safe position, a pooled one already wears what the player wears
         vector pos = GetGame().GetCurrentCameraPosition() - (GetGame().GetCurrentCameraDirection() * 0.5);
         pos[1] = GetGame().GetPlayer().GetPosition()[1];
         
-        entPlayerPreview = PlayerBase.Cast(GetGame().CreateObjectEx(GetGame().GetPlayer().GetType(), pos, ECE_LOCAL|ECE_NOLIFETIME));
+        entPlayerPreview = PlayerBase.Cast(TraderXPreviewEntityPool.GetInstance().Acquire(GetGame().GetPlayer().GetType(), GetPlayerClothingClassNames(), pos));
         if (entPlayerPreview && playerPreview)
         {
             playerPreview.SetPlayer(entPlayerPreview);
@@ -58,6 +56,21 @@ class PlayerPreviewController: ViewController
         }
     }
 
+    protected TStringArray GetPlayerClothingClassNames()
+    {
+        TStringArray classNames = new TStringArray();
+        PlayerBase player = PlayerBase.Cast(GetGame().GetPlayer());
+        if (!player) return classNames;
+
+        foreach (string slot: StaticTraderXCoreLists.playerAttachments)
+        {
+            EntityAI sourceItem = player.FindAttachmentBySlotName(slot);
+            if (sourceItem && slot != "Hand")
+                classNames.Insert(sourceItem.GetType());
+        }
+        return classNames;
+    }
+
     protected void UpdatePreviewPosition()
     {
         if (!playerPreview || !entPlayerPreview) return;
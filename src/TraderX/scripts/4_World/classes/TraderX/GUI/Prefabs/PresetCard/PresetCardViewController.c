@@ -17,12 +17,9 @@ class PresetCardViewController: ViewController
 
     void ~PresetCardViewController()
     {
-        // Clean up preview entity when controller is destroyed
-        if (preview)
-        {
-            GetGame().ObjectDelete(preview);
-            preview = null;
-        }
+        // Hand the preview back to the pool when controller is destroyed
+        TraderXPreviewEntityPool.GetInstance().Release(preview);
+        preview = null;
     }
 
     void Setup(TraderXPreset preset, bool isServerPreset)
@@ -43,12 +40,7 @@ class PresetCardViewController: ViewController
         int intPrice = TraderXPresetsService.GetInstance().CalculateTotalPricePreset(preset);
         price = TraderXQuantityManager.GetFormattedMoneyAmount(intPrice);
 
-        TraderXProduct item = TraderXProductRepository.GetItemById(preset.productId);
-
-        // Create base item preview
-        preview = EntityAI.Cast(GetGame().CreateObjectEx(item.className, vector.Zero, ECE_LOCAL|ECE_NOLIFETIME));
-        
-        // Add attachments to preview
+        // Base item preview with its attachments
         CreatePresetPreviewWithAttachments();
         
         if (preset)
@@ -64,10 +56,14 @@ class PresetCardViewController: ViewController
     
     void CreatePresetPreviewWithAttachments()
     {
-        if (!preview || !preset)
+        if (!preset)
             return;
-            
-        // Attach each configured attachment to the preview
+
+        TraderXProduct item = TraderXProductRepository.GetItemById(preset.productId);
+        if (!item)
+            return;
+
+        TStringArray attachmentClassNames = new TStringArray();
         foreach (string attachmentId : preset.attachments)
         {
             TraderXProduct attachmentProduct = TraderXProductRepository.GetItemById(attachmentId);
@@ -76,29 +72,21 @@ class PresetCardViewController: ViewController
                 GetTraderXLogger().LogWarning(string.Format("CreatePresetPreviewWithAttachments - Attachment product not found: %1", attachmentId));
                 continue;
             }
-            
-            // Create attachment entity
-            EntityAI attachmentEntity = EntityAI.Cast(GetGame().CreateObjectEx(attachmentProduct.className, vector.Zero, ECE_LOCAL|ECE_NOLIFETIME));
-            if (!attachmentEntity)
-            {
-                GetTraderXLogger().LogWarning(string.Format("CreatePresetPreviewWithAttachments - Failed to create attachment entity: %1", attachmentProduct.className));
-                continue;
-            }
-            
-            // Try to attach to preview
-            bool attached = TraderXAttachmentHandler.TryAttachItem(preview, attachmentEntity);
-            if (attached)
-            {
-                GetTraderXLogger().LogDebug(string.Format("CreatePresetPreviewWithAttachments - Successfully attached: %1", attachmentProduct.GetDisplayName()));
-            }
-            else
-            {
-                GetTraderXLogger().LogWarning(string.Format("CreatePresetPreviewWithAttachments - Failed to attach: %1", attachmentProduct.GetDisplayName()));
-                // Clean up failed attachment
-                GetGame().ObjectDelete(attachmentEntity);
-            }
+
+            attachmentClassNames.Insert(attachmentProduct.className);
         }
-        
+
+        // Pooled preview, a preview of this preset shown before comes back with its attachments in place
+        preview = TraderXPreviewEntityPool.GetInstance().Acquire(item.className, attachmentClassNames);
+        if (!preview)
+            return;
+
+        foreach (string attachmentClassName : attachmentClassNames)
+        {
+            if (!TraderXPreviewEntityPool.HasAttachment(preview, attachmentClassName))
+                GetTraderXLogger().LogWarning(string.Format("CreatePresetPreviewWithAttachments - Failed to attach: %1", attachmentClassName));
+        }
+
         GetTraderXLogger().LogDebug(string.Format("CreatePresetPreviewWithAttachments - Completed for preset: %1", preset.presetName));
     }
 
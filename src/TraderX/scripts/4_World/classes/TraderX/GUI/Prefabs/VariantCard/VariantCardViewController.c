@@ -7,6 +7,11 @@ class VariantCardViewController: ViewController
     string variant_classname, variant_price;
 
     EntityAI preview;
+
+    void ~VariantCardViewController()
+    {
+        TraderXPreviewEntityPool.GetInstance().Release(preview);
+    }
     
     void Setup(TraderXProduct item)
     {
@@ -15,7 +20,7 @@ class VariantCardViewController: ViewController
         variant_classname = item.GetDisplayName();
         variant_price = TraderXQuantityManager.GetFormattedMoneyAmount(item.buyPrice);
 
-        preview = EntityAI.Cast(GetGame().CreateObjectEx(item.className, vector.Zero, ECE_LOCAL|ECE_NOLIFETIME));
+        preview = TraderXPreviewEntityPool.GetInstance().Acquire(item.className, new TStringArray());
         NotifyPropertiesChanged({"variant_classname", "variant_price", "preview"});
     }
     
@@ -38,7 +38,7 @@ class TraderXMainViewController: ViewController
         int npcId = TraderXTradingService.GetInstance().GetNpcId();
         if (npcId != -1)
         {
-            TraderXNpc npc = GetTraderXModule().GetSettings().GetNpcById(npcId);
+            TraderXNpc npc = TraderXNpcTradeViewRepository.GetNpc(npcId);
             if (npc)
             {
                 trader_name = npc.GetGivenName();
@@ -0,0 +1,114 @@
+/**
+ * TraderXInitTask - One resumable step of the server startup
+ * Run is called once per frame until it returns true, a step that has more work than
+ * fits in a frame keeps its own cursor and returns false to be resumed on the next one.
+ * Such a step works in small chunks and checks IsFrameBudgetSpent between them.
+ */
+class TraderXInitTask
+{
+    private int m_FrameStartTicks;
+    private float m_FrameBudgetMs;
+
+    string GetName()
+    {
+        return ClassName();
+    }
+
+    // Called by the runner before each Run
+    void BeginFrame(int frameStartTicks, float frameBudgetMs)
+    {
+        m_FrameStartTicks = frameStartTicks;
+        m_FrameBudgetMs = frameBudgetMs;
+    }
+
+    // True once the startup has used its share of the current frame
+    bool IsFrameBudgetSpent()
+    {
+        return TraderXTransactionScheduler.TicksToMs(TickCount(m_FrameStartTicks)) >= m_FrameBudgetMs;
+    }
+
+    // True once the step is complete
+    bool Run()
+    {
+        return true;
+    }
+}
+
+/**
+ * TraderXInitTaskRunner - Runs startup steps cooperatively from the module update
+ * Steps are run in order until the frame budget is spent, the rest waits for the next frame.
+ * Sliced steps read the same budget inside their loops. At least one step is always run per
+ * frame and every Run makes progress, so the startup cannot stall.
+ */
+class TraderXInitTaskRunner
+{
+    private ref array<ref TraderXInitTask> m_Tasks;
+    private int m_CurrentTask;
+    private float m_FrameBudgetMs;
+
+    private float m_TaskMs;
+    private int m_TaskFrames;
+    private float m_TotalMs;
+    private int m_TotalFrames;
+    private float m_LongestFrameMs;
+
+    void TraderXInitTaskRunner(float frameBudgetMs)
+    {
+        m_Tasks = new array<ref TraderXInitTask>();
+        m_FrameBudgetMs = frameBudgetMs;
+    }
+
+    void AddTask(TraderXInitTask task)
+    {
+        m_Tasks.Insert(task);
+    }
+
+    bool IsFinished()
+    {
+        return m_CurrentTask >= m_Tasks.Count();
+    }
+
+    void Update()
+    {
+        if (IsFinished())
+            return;
+
+        int frameStart = TickCount(0);
+        m_TotalFrames++;
+
+        while (!IsFinished())
+        {
+            TraderXInitTask task = m_Tasks[m_CurrentTask];
+
+            int taskStart = TickCount(0);
+            task.BeginFrame(frameStart, m_FrameBudgetMs);
+            bool done = task.Run();
+            m_TaskMs += TraderXTransactionScheduler.TicksToMs(TickCount(taskStart));
+            m_TaskFrames++;
+
+            if (done)
+                CompleteTask(task);
+
+            // A resumed step has used its share of this frame
+            if (!done || TraderXTransactionScheduler.TicksToMs(TickCount(frameStart)) >= m_FrameBudgetMs)
+                break;
+        }
+
+        float frameMs = TraderXTransactionScheduler.TicksToMs(TickCount(frameStart));
+        m_TotalMs += frameMs;
+        if (frameMs > m_LongestFrameMs)
+            m_LongestFrameMs = frameMs;
+
+        if (IsFinished())
+            GetTraderXLogger().LogInfo(string.Format("[INIT] Server startup complete: %1 steps in %2 ms over %3 frames, longest frame %4 ms", m_Tasks.Count(), m_TotalMs, m_TotalFrames, m_LongestFrameMs));
+    }
+
+    private void CompleteTask(TraderXInitTask task)
+    {
+        m_CurrentTask++;
+        GetTraderXLogger().LogInfo(string.Format("[INIT] %1/%2 %3 done in %4 ms over %5 frames", m_CurrentTask, m_Tasks.Count(), task.GetName(), m_TaskMs, m_TaskFrames));
+
+        m_TaskMs = 0;
+        m_TaskFrames = 0;
+    }
+}
@@ -9,13 +9,21 @@ class TraderXModule : CF_ModuleWorld
     ref TraderXGeneralSettings generalSettings;
 
     static ref ScriptInvoker Event_OnTraderXPlayerJoined = new ScriptInvoker();
+    // Server: every startup step is done, config, catalog and npcs are in place
+    static ref ScriptInvoker Event_OnTraderXServerInitialized = new ScriptInvoker();
 
     ref TraderXMainView traderXMainView;
 
+    // Server startup runs over several frames, players joining meanwhile wait in m_PendingJoins
+    private ref TraderXInitTaskRunner m_InitRunner;
+    private bool m_IsInitialized;
+    private ref array<ref Param2<PlayerBase, PlayerIdentity>> m_PendingJoins = new array<ref Param2<PlayerBase, PlayerIdentity>>();
+
     override void OnInit()
     {
         super.OnInit();
         EnableMissionStart();
+        EnableMissionFinish();
         EnableUpdate();
     }
 
@@ -23,19 +31,8 @@ class TraderXModule : CF_ModuleWorld
     {
         if(GetGame().IsServer())
         {
-            // Convert old V1 configs to V2 format before loading repositories
-            oldTraderXPriceConfig.ConvertOldConfigToNew();
-            oldTraderXGeneralSettings.ConvertOldConfigToNew();
-
-            // Load user's source format preference
-            TraderXSourceConfig sourceConfig = TraderXSourceConfigLoader.LoadConfig();
-            
-            // Initialize configuration using the service (handles all format loading and migration)
-            TraderXConfigurationService.GetInstance().Initialize(sourceConfig);
-            
-            generalSettings = TraderXSettingsRepository.Load();
-            TraderXPresetsService.GetInstance().GetInstance();
-            TraderXNpcService.GetInstance().CreateNpcs();
+            // The steps run from OnUpdate within the frame budget
+            m_InitRunner = CreateServerInitRunner();
         }
         else
         {
@@ -43,28 +40,82 @@ class TraderXModule : CF_ModuleWorld
             TraderXTransactionNotifier.GetInstance();
             TraderXNotificationService.GetInstance();
             TraderXPresetsService.GetInstance().GetInstance();
+            m_IsInitialized = true;
         }
 
         InitRPCs();
     }
 
+    TraderXInitTaskRunner CreateServerInitRunner()
+    {
+        TraderXInitTaskRunner runner = new TraderXInitTaskRunner(TraderXPerformanceSettingsRepository.GetSettings().initFrameBudgetMs);
+
+        // Convert old V1 configs to V2 format before loading repositories
+        runner.AddTask(new TraderXConvertOldConfigsTask());
+        runner.AddTask(new TraderXLoadConfigurationTask());
+        runner.AddTask(new TraderXApplyRestartStockTask());
+        runner.AddTask(new TraderXPublishCatalogTask());
+        runner.AddTask(new TraderXLoadGeneralSettingsTask());
+        runner.AddTask(new TraderXLoadPresetsTask());
+        runner.AddTask(new TraderXCreateNpcsTask());
+        return runner;
+    }
+
+    bool IsInitialized()
+    {
+        return m_IsInitialized;
+    }
+
+    // Players who joined during startup get their config and catalog now
+    private void OnServerInitialized()
+    {
+        m_IsInitialized = true;
+        m_InitRunner = null;
+
+        int delivered = 0;
+        foreach (Param2<PlayerBase, PlayerIdentity> pendingJoin : m_PendingJoins)
+        {
+            // Disconnected while waiting
+            if (!pendingJoin.param1 || !pendingJoin.param2)
+                continue;
+
+            OnPlayerJoined(pendingJoin.param1, pendingJoin.param2);
+            delivered++;
+        }
+
+        if (m_PendingJoins.Count() > 0)
+            GetTraderXLogger().LogInfo(string.Format("[INIT] Delivered config to %1 of %2 players who joined during startup", delivered, m_PendingJoins.Count()));
+
+        m_PendingJoins.Clear();
+
+        Event_OnTraderXServerInitialized.Invoke();
+    }
+
     TraderXGeneralSettings GetSettings()
     {
         return generalSettings;
     }
 
+    // Call whenever the npc list or the catalog changes
+    void RebuildNpcTradeViews()
+    {
+        if (!generalSettings)
+            return;
+
+        TraderXNpcTradeViewRepository.Build(generalSettings.traders);
+    }
+
     void InitRPCs()
     {
         TraderXTransactionService.GetInstance().RegisterRPCs();
         TraderXPresetsService.GetInstance().RegisterRPCs();
         TraderXCurrencyService.GetInstance().RegisterRPCs();
         TraderXVehicleParkingService.GetInstance().RegisterRPCs();
+        TraderXCatalogService.GetInstance().RegisterRPCs();
 
         if(GetGame().IsClient())
         {
             GetRPCManager().AddRPC("TraderX", "GetConfigResponse", this, SingeplayerExecutionType.Client);
-            GetRPCManager().AddRPC("TraderX", "GetTraderCategoriesResponse", this, SingeplayerExecutionType.Client);
-            GetRPCManager().AddRPC("TraderX", "GetTraderProductsResponse", this, SingeplayerExecutionType.Client);
             GetRPCManager().AddRPC("TraderX", "GetTraderStockResponse", this, SingeplayerExecutionType.Client);
             GetRPCManager().AddRPC("TraderX", "GetPlayerLicensesResponse", this, SingeplayerExecutionType.Client);
             GetRPCManager().AddRPC("TraderX", "GetTraderXCurrencyResponse", TraderXCurrencyService.GetInstance(), SingeplayerExecutionType.Client);
@@ -98,6 +149,8 @@ class TraderXModule : CF_ModuleWorld
             TraderXTradingService.GetInstance().ClearNpc();
             traderXMainView.Show(false);
             delete traderXMainView;
+            // Previews released by the closed menu are not kept around between trader visits
+            TraderXPreviewEntityPool.GetInstance().Clear();
         }
     }
 
@@ -110,14 +163,14 @@ class TraderXModule : CF_ModuleWorld
         if(!player)
             return;
 
-        Param1<int> data;
+        Param2<int, int> data;
         if(!ctx.Read(data)){
             return;
         }
 
         int npcId = data.param1;
         TraderXNpcSessionService.GetInstance().AddPlayerToNpcId(player, npcId);
-        SendTraderStockToClient(player, npcId);
+        SendTraderStockToClient(player, npcId, data.param2);
     }
 
     void OnTraderXMenuClose(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
@@ -138,18 +191,32 @@ class TraderXModule : CF_ModuleWorld
         TraderXNpcSessionService.GetInstance().RemovePlayerFromNpcId(player, npcId);
     }
 
-    void SendTraderStockToClient(PlayerBase player, int npcId)
+    /**
+     * Send the npc stock the client is missing
+     * @param knownVersion stock version the client already holds for this npc, 0 for none.
+     *        The reply is the full stock, only the products changed since, or nothing at all.
+     */
+    void SendTraderStockToClient(PlayerBase player, int npcId, int knownVersion = 0)
     {
-        TraderXNpc npc = generalSettings.GetNpcById(npcId);
+        TraderXNpc npc = TraderXNpcTradeViewRepository.GetNpc(npcId);
 
         if(!npc){
             GetTraderXLogger().LogError("GetTraderStockRequest:: npc wasn't found from id: " + npcId);
             return;
         }
 
+        int currentVersion = TraderXProductStockRepository.GetStockVersion();
+
+        // A version ahead of ours was handed out by a previous server run. Clients forget their
+        // versions on join, this only guards against those that did not
+        if(knownVersion > currentVersion)
+            knownVersion = 0;
+
         array<ref TraderXProductStock> npcStock = new array<ref TraderXProductStock>();
-        TraderXProductStockRepository.GetStockArrForCategoriesId(npc.categoriesId, npcStock);
-        GetRPCManager().SendRPC("TraderX", "GetTraderStockResponse", new Param1<array<ref TraderXProductStock>>(npcStock), true, player.GetIdentity());
+        if(knownVersion < currentVersion)
+            TraderXProductStockRepository.GetStockArrForCategoriesId(npc.categoriesId, npcStock, knownVersion);
+
+        GetRPCManager().SendRPC("TraderX", "GetTraderStockResponse", new Param3<int, int, array<ref TraderXProductStock>>(npcId, currentVersion, npcStock), true, player.GetIdentity());
     }
 
     void GetTraderStockResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
@@ -157,13 +224,14 @@ class TraderXModule : CF_ModuleWorld
         if(type != CallType.Client)
             return;
 
-        Param1<array<ref TraderXProductStock>> data;
+        Param3<int, int, array<ref TraderXProductStock>> data;
         if(!ctx.Read(data)){
             return;
         }
 
-        array<ref TraderXProductStock> npcStock = data.param1;
+        array<ref TraderXProductStock> npcStock = data.param3;
         TraderXProductStockRepository.RefStockToTraderXProduct(npcStock);
+        TraderXProductStockRepository.SetKnownStockVersion(data.param1, data.param2);
         TraderXTradingService.GetInstance().OnTraderXResponseReceived(ETraderXResponse.ALL_STOCK_RECEIVED);
     }
 
@@ -193,65 +261,32 @@ class TraderXModule : CF_ModuleWorld
         GetTraderXLogger().LogDebug("GetConfigResponse serverId " + data.param1.serverID);
 
         generalSettings = data.param1;
+        RebuildNpcTradeViews();
+
+        // Sent on every join, versions known from an earlier session may belong to another server run
+        TraderXProductStockRepository.ClearKnownStockVersions();
         TraderXInventoryManager.CheckEntityNetworkId(PlayerBase.Cast(GetGame().GetPlayer()));
 
         TraderXPresetsService.GetInstance().SetServerId(data.param1.serverID);
     }
 
-    void GetTraderCategoriesResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
-    {
-        if(type != CallType.Client)
-            return;
-
-        Param1<array<ref TraderXCategory>> data;
-        if(!ctx.Read(data)){
-            GetTraderXLogger().LogError("GetTraderCategoriesResponse:: failed to read data");
-            return;
-        }
-
-        GetTraderXLogger().LogDebug("GetTraderCategoriesResponse:: data read");
-
-        TraderXCategoryRepository.SetCategories(data.param1);
-        TraderXCategoryRepository.DebugSaveAllCategories();
-    }
-
-    void GetTraderProductsResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
-    {
-        if(type != CallType.Client)
-            return;
-
-        Param1<array<ref TraderXProduct>> data;
-        if(!ctx.Read(data)){
-            GetTraderXLogger().LogError("GetTraderProductsResponse:: failed to read data");
-            return;
-        }
-
-        TraderXJsonLoader<array<ref TraderXProduct>>.SaveToFile(TRADERX_PRODUCTS_DIR + "RPCAllItems.json", data.param1);
-        TraderXProductRepository.SetProducts(data.param1);
-        TraderXProductRepository.DebugSaveAllItems();
-    }
-
     void SendGeneralConfig(PlayerIdentity identity)
     {
         GetRPCManager().SendRPC("TraderX", "GetConfigResponse", new Param1<TraderXGeneralSettings>(generalSettings), true, identity);
     }
 
-    void SendTraderXCategories(PlayerIdentity identity)
-    {
-        GetRPCManager().SendRPC("TraderX", "GetTraderCategoriesResponse", new Param1<array<ref TraderXCategory>>(TraderXCategoryRepository.GetCategories()), true, identity);
-    }
-
-    void SendTraderXProducts(PlayerIdentity identity)
-    {
-        TraderXJsonLoader<array<ref TraderXProduct>>.SaveToFile(TRADERX_PRODUCTS_DIR + "RPCAllItems.json", TraderXProductRepository.GetProducts());
-        GetRPCManager().SendRPC("TraderX", "GetTraderProductsResponse", new Param1<array<ref TraderXProduct>>(TraderXProductRepository.GetProducts()), true, identity);
-    }
-
     void OnPlayerJoined(PlayerBase player, PlayerIdentity identity)
     {
+        // Nothing consistent to send yet, delivered once startup completes
+        if (!m_IsInitialized)
+        {
+            m_PendingJoins.Insert(new Param2<PlayerBase, PlayerIdentity>(player, identity));
+            return;
+        }
+
         SendGeneralConfig(identity);
-        SendTraderXCategories(identity);
-        SendTraderXProducts(identity);
+        GetTraderXLogger().SendLogLevel(identity);
+        TraderXCatalogService.GetInstance().SendCatalogHash(identity);
         TraderXInventoryManager.CheckEntityNetworkId(player);
         Event_OnTraderXPlayerJoined.Invoke(player, identity);
     }
@@ -267,6 +302,14 @@ class TraderXModule : CF_ModuleWorld
         }
     }
 
+    override void OnMissionFinish(Class sender, CF_EventArgs args)
+    {
+        super.OnMissionFinish(sender, args);
+        if(GetGame().IsServer()){
+            TraderXProductStockRepository.Shutdown();
+        }
+    }
+
     override void OnUpdate(Class sender, CF_EventArgs args)
     {
         super.OnUpdate(sender, args);
@@ -274,11 +317,27 @@ class TraderXModule : CF_ModuleWorld
     
         if (GetGame().IsServer())
         {
+            if (!m_IsInitialized)
+            {
+                if (!m_InitRunner)
+                    return;
+
+                m_InitRunner.Update();
+                if (m_InitRunner.IsFinished())
+                    OnServerInitialized();
+                return;
+            }
+
             TraderXTransactionService.GetInstance().ProcessTransactionQueue(update.DeltaTime);
+            TraderXNpcSessionService.GetInstance().BroadcastStockChanges();
+
+            int flushStart = TraderXTransactionMetrics.StartTimer();
+            if (TraderXProductStockRepository.FlushIfDue(update.DeltaTime))
+                TraderXTransactionMetrics.GetInstance().RecordStage(TraderXTransactionMetrics.STAGE_STOCK_FLUSH, flushStart);
         }
         else if(GetGame().IsClient())
         {
-           TraderXTransactionService.GetInstance().ProcessTransactionResponseQueue(update.DeltaTime);
+           TraderXTransactionService.GetInstance().ProcessTransactionResponseQueue();
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,192 @@
+/**
+ * Server startup steps, queued in order by TraderXModule.CreateServerInitRunner
+ * Steps with work proportional to the catalog or the trader list keep a cursor and work in small
+ * chunks until the frame budget is spent: catalog mapping, the restart stock sweep and npc
+ * creation. The rest run in one frame.
+ */
+class TraderXConvertOldConfigsTask : TraderXInitTask
+{
+    override string GetName()
+    {
+        return "Convert V1 configs";
+    }
+
+    override bool Run()
+    {
+        oldTraderXPriceConfig.ConvertOldConfigToNew();
+        oldTraderXGeneralSettings.ConvertOldConfigToNew();
+        return true;
+    }
+}
+
+// Compile, read, then map the catalog within the frame budget, each phase in its own frame
+class TraderXLoadConfigurationTask : TraderXInitTask
+{
+    static const int ENTRIES_PER_CHUNK = 50;
+
+    private ref TraderXSourceConfig m_SourceConfig;
+    private ref TraderXCatalogLoadCursor m_Cursor;
+
+    override string GetName()
+    {
+        return "Load catalog";
+    }
+
+    override bool Run()
+    {
+        TraderXConfigurationService service = TraderXConfigurationService.GetInstance();
+
+        if (!m_SourceConfig)
+        {
+            // Compiles the sources first when the selected format needs it
+            m_SourceConfig = TraderXSourceConfigLoader.LoadConfig();
+            service.PrepareConfiguration(m_SourceConfig);
+            return false;
+        }
+
+        if (!m_Cursor)
+        {
+            m_Cursor = service.BeginCatalogLoad(m_SourceConfig);
+            return false;
+        }
+
+        while (!m_Cursor.Run(ENTRIES_PER_CHUNK))
+        {
+            if (IsFrameBudgetSpent())
+                return false;
+        }
+
+        service.CompleteCatalogLoad();
+        return true;
+    }
+}
+
+// New stock values are computed within the frame budget and persisted together once the sweep is done
+class TraderXApplyRestartStockTask : TraderXInitTask
+{
+    static const int PRODUCTS_PER_CHUNK = 25;
+
+    private ref array<ref TraderXProduct> m_Products;
+    private ref map<string, int> m_ChangedStock;
+    private int m_NextProduct;
+
+    override string GetName()
+    {
+        return "Apply restart stock";
+    }
+
+    override bool Run()
+    {
+        if (!m_Products)
+        {
+            m_Products = TraderXConfigurationService.GetInstance().BeginRestartStock();
+            m_ChangedStock = new map<string, int>();
+            return false;
+        }
+
+        if (m_NextProduct < m_Products.Count())
+        {
+            while (m_NextProduct < m_Products.Count())
+            {
+                int end = m_NextProduct + PRODUCTS_PER_CHUNK;
+                if (end > m_Products.Count())
+                    end = m_Products.Count();
+
+                TraderXProductStockRepository.ApplyRestartBehaviorsRange(m_Products, m_NextProduct, end, m_ChangedStock);
+                m_NextProduct = end;
+
+                if (IsFrameBudgetSpent())
+                    return false;
+            }
+
+            // The commit writes the whole sweep, it gets a frame of its own
+            return false;
+        }
+
+        TraderXConfigurationService.GetInstance().CompleteRestartStock(m_Products, m_ChangedStock);
+        return true;
+    }
+}
+
+class TraderXPublishCatalogTask : TraderXInitTask
+{
+    override string GetName()
+    {
+        return "Publish catalog";
+    }
+
+    override bool Run()
+    {
+        TraderXConfigurationService.GetInstance().PublishCatalog();
+        return true;
+    }
+}
+
+class TraderXLoadGeneralSettingsTask : TraderXInitTask
+{
+    override string GetName()
+    {
+        return "Load general settings";
+    }
+
+    override bool Run()
+    {
+        TraderXModule module = GetTraderXModule();
+        module.generalSettings = TraderXSettingsRepository.Load();
+        module.RebuildNpcTradeViews();
+        GetTraderXLogger().LogInfo(TraderXPerformanceSettingsRepository.Reload().GetSettingsSummary());
+        return true;
+    }
+}
+
+class TraderXLoadPresetsTask : TraderXInitTask
+{
+    override string GetName()
+    {
+        return "Load presets";
+    }
+
+    override bool Run()
+    {
+        TraderXPresetsService.GetInstance();
+        return true;
+    }
+}
+
+// Spawning is the costly part of startup, traders are created a few per frame within the budget
+class TraderXCreateNpcsTask : TraderXInitTask
+{
+    static const int NPCS_PER_FRAME = 4;
+
+    private int m_NextNpc;
+
+    override string GetName()
+    {
+        return "Create npcs";
+    }
+
+    override bool Run()
+    {
+        array<ref TraderXNpc> traders = GetTraderXModule().GetSettings().traders;
+        if (!traders)
+            return true;
+
+        if (m_NextNpc == 0)
+            GetTraderXLogger().LogDebug("[TraderX] CreateNpcs initiated");
+
+        int end = m_NextNpc + NPCS_PER_FRAME;
+        if (end > traders.Count())
+            end = traders.Count();
+
+        while (m_NextNpc < end)
+        {
+            TraderXNpcService.GetInstance().CreateNpc(traders[m_NextNpc]);
+            m_NextNpc++;
+
+            if (IsFrameBudgetSpent())
+                break;
+        }
+
+        return m_NextNpc >= traders.Count();
+    }
+}
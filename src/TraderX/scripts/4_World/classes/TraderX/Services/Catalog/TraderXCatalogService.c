@@ -0,0 +1,193 @@
+/**
+ * TraderXCatalogService - Delivers the trader catalog (categories + products) to clients
+ * On join the server only announces the catalog hash. A client holding a cached copy for that
+ * hash loads it from disk, otherwise it requests the full catalog and stores it for next time.
+ */
+class TraderXCatalogService
+{
+    static ref TraderXCatalogService m_instance;
+
+    // Server: serialized once after config load, shared by every requester
+    private ref TraderXCatalogPayload m_Payload;
+
+    // Client: last applied catalog
+    private ref TraderXCatalog m_Catalog;
+
+    // Position of each product in the catalog, shared by both sides so stock deltas can refer to
+    // products by index instead of by id
+    private ref map<string, int> m_ProductIndexById = new map<string, int>();
+    private ref TStringArray m_ProductIdByIndex = new TStringArray();
+
+    static TraderXCatalogService GetInstance()
+    {
+        if (!m_instance)
+        {
+            m_instance = new TraderXCatalogService();
+        }
+        return m_instance;
+    }
+
+    void RegisterRPCs()
+    {
+        if (GetGame().IsClient())
+        {
+            GetRPCManager().AddRPC("TraderX", "GetCatalogHashResponse", this, SingeplayerExecutionType.Client);
+            GetRPCManager().AddRPC("TraderX", "GetCatalogResponse", this, SingeplayerExecutionType.Client);
+        }
+        else
+        {
+            GetRPCManager().AddRPC("TraderX", "RequestCatalog", this, SingeplayerExecutionType.Server);
+        }
+    }
+
+    //----------------------------------------------------------------//
+	//Server
+	//----------------------------------------------------------------//
+
+    /**
+     * Serialize the catalog from the repositories, call whenever products or categories change
+     */
+    void RebuildCatalog()
+    {
+        TraderXCatalog catalog = TraderXCatalog.CreateFromRepositories();
+        m_Payload = TraderXCatalogPayload.Build(catalog);
+        IndexProducts(catalog);
+
+        GetTraderXLogger().LogInfo(string.Format("[CATALOG] Catalog built: %1 categories, %2 products, %3 chars in %4 chunks, hash %5",
+            catalog.categories.Count(), catalog.products.Count(), m_Payload.GetSize(), m_Payload.GetChunks().Count(), m_Payload.GetHash()));
+    }
+
+    // -1 when the product is not part of the catalog
+    int GetProductIndex(string productId)
+    {
+        GetPayload();
+
+        int index;
+        if (m_ProductIndexById.Find(productId, index))
+            return index;
+
+        return -1;
+    }
+
+    TraderXCatalogPayload GetPayload()
+    {
+        if (!m_Payload)
+            RebuildCatalog();
+
+        return m_Payload;
+    }
+
+    void SendCatalogHash(PlayerIdentity identity)
+    {
+        GetRPCManager().SendRPC("TraderX", "GetCatalogHashResponse", new Param1<string>(GetPayload().GetHash()), true, identity);
+    }
+
+    void SendCatalog(PlayerIdentity identity)
+    {
+        TraderXCatalogPayload payload = GetPayload();
+        GetRPCManager().SendRPC("TraderX", "GetCatalogResponse", new Param2<string, TStringArray>(payload.GetHash(), payload.GetChunks()), true, identity);
+    }
+
+    void RequestCatalog(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
+    {
+        if (type != CallType.Server || !sender)
+            return;
+
+        Param1<string> data;
+        if (!ctx.Read(data))
+            return;
+
+        GetTraderXLogger().LogDebug(string.Format("[CATALOG] %1 requested the full catalog (cached hash: %2)", sender.GetId(), data.param1));
+        SendCatalog(sender);
+    }
+
+    //----------------------------------------------------------------//
+	//Client
+	//----------------------------------------------------------------//
+
+    void GetCatalogHashResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
+    {
+        if (type != CallType.Client)
+            return;
+
+        Param1<string> data;
+        if (!ctx.Read(data))
+            return;
+
+        string hash = data.param1;
+        if (m_Catalog && m_Catalog.hash == hash)
+            return;
+
+        TraderXCatalog cachedCatalog = TraderXCatalogCacheRepository.Load(hash);
+        if (cachedCatalog)
+        {
+            GetTraderXLogger().LogDebug("[CATALOG] Using cached catalog " + hash);
+            ApplyCatalog(cachedCatalog);
+            return;
+        }
+
+        string cachedHash = string.Empty;
+        if (m_Catalog)
+            cachedHash = m_Catalog.hash;
+
+        GetRPCManager().SendRPC("TraderX", "RequestCatalog", new Param1<string>(cachedHash), true, null);
+    }
+
+    void GetCatalogResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
+    {
+        if (type != CallType.Client)
+            return;
+
+        Param2<string, TStringArray> data;
+        if (!ctx.Read(data))
+        {
+            GetTraderXLogger().LogError("GetCatalogResponse:: failed to read data");
+            return;
+        }
+
+        TraderXCatalog catalog = TraderXCatalogPayload.ToCatalog(data.param1, data.param2);
+        if (!catalog)
+        {
+            GetTraderXLogger().LogError("GetCatalogResponse:: catalog could not be parsed");
+            return;
+        }
+
+        ApplyCatalog(catalog);
+        TraderXCatalogCacheRepository.Save(catalog);
+    }
+
+    string GetProductIdByIndex(int index)
+    {
+        if (index < 0 || index >= m_ProductIdByIndex.Count())
+            return string.Empty;
+
+        return m_ProductIdByIndex[index];
+    }
+
+    private void ApplyCatalog(TraderXCatalog catalog)
+    {
+        m_Catalog = catalog;
+        IndexProducts(catalog);
+
+        TraderXCategoryRepository.SetCategories(catalog.categories);
+        TraderXCategoryRepository.DebugSaveAllCategories();
+
+        TraderXProductRepository.SetProducts(catalog.products);
+        TraderXProductRepository.DebugSaveAllItems();
+
+        GetTraderXModule().RebuildNpcTradeViews();
+        TraderXPresetsService.GetInstance().InvalidatePriceCache();
+    }
+
+    private void IndexProducts(TraderXCatalog catalog)
+    {
+        m_ProductIndexById.Clear();
+        m_ProductIdByIndex.Clear();
+
+        foreach (int index, TraderXProduct product : catalog.products)
+        {
+            m_ProductIndexById.Set(product.productId, index);
+            m_ProductIdByIndex.Insert(product.productId);
+        }
+    }
+}
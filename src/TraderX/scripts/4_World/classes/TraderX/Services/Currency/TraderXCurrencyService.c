@@ -4,6 +4,10 @@ class TraderXCurrencyService
 
     ref TraderXCurrencyTypeCollection currencySettings;
 
+    // Lowercase className of every configured denomination, rebuilt when currencySettings is replaced
+    private ref map<string, bool> m_CurrencyClassNames;
+    private TraderXCurrencyTypeCollection m_CurrencyClassNamesSource;
+
     static TraderXCurrencyService GetInstance()
     {
         if (!m_instance)
@@ -59,8 +63,27 @@ class TraderXCurrencyService
       return amount; 
     }
 
+    // Balance in the currencies a trader accepts, membership comes from the trade view's currency set
+    int GetPlayerMoneyForTrader(PlayerBase player, TraderXNpcTradeView npcView)
+    {
+      int amount = 0;
+      foreach(TraderXCurrencyType currencyType : currencySettings.currencyTypes)
+      {
+        if(!npcView.AcceptsCurrency(currencyType.currencyName))
+            continue;
+
+        amount += GetPlayerMoneyFromCurrency(player, currencyType);
+      }
+
+      return amount;
+    }
+
     int GetPlayerMoneyFromCurrency(PlayerBase player, TraderXCurrencyType currencyType)
     {
+      TraderXPlayerWallet wallet = GetPlayerWallet(player);
+      if(wallet)
+        return wallet.GetValue(currencyType);
+
        int amount = 0;
 
       array<EntityAI> itemsArray = TraderXInventoryManager.GetItemsArray(player);
@@ -104,6 +127,8 @@ class TraderXCurrencyService
         if(playerMoney < amountToRemove)
             return false;
 
+        TraderXPlayerWallet wallet = GetPlayerWallet(player);
+
         int amountRemoved = 0;
         int take = 0;
         int moneyAmountRemaining = amountToRemove;
@@ -120,7 +145,11 @@ class TraderXCurrencyService
                 if(moneyAmountRemaining <= 0)
                     break;
 
-                int currentCurrencyQuantity = TraderXQuantityManager.GetTotalQuantityOfItem(player, currency.GetCurrencyClassName());
+                int currentCurrencyQuantity;
+                if(wallet)
+                    currentCurrencyQuantity = wallet.GetQuantity(currency.GetCurrencyClassName(), true);
+                else
+                    currentCurrencyQuantity = TraderXQuantityManager.GetTotalQuantityOfItem(player, currency.GetCurrencyClassName());
                 if(currentCurrencyQuantity <= 0)
                     continue;
 
@@ -142,7 +171,11 @@ class TraderXCurrencyService
 
                 if(take > 0)
                 {
-                    bool success = TraderXInventoryManager.RemoveOurProduct(player, currency.GetCurrencyClassName(), take);
+                    bool success;
+                    if(wallet)
+                        success = wallet.RemoveMoney(currency.GetCurrencyClassName(), take);
+                    else
+                        success = TraderXInventoryManager.RemoveOurProduct(player, currency.GetCurrencyClassName(), take);
                     if (!success)
                         return false;
 
@@ -172,6 +205,40 @@ class TraderXCurrencyService
         return amountRemoved >= amountToRemove;
     }
 
+    /**
+     * Wallet index of the player, server only. The client keeps scanning its own inventory.
+     */
+    TraderXPlayerWallet GetPlayerWallet(PlayerBase player)
+    {
+        if(!player || !GetGame().IsServer())
+            return null;
+
+        return player.GetTraderXWallet();
+    }
+
+    bool IsCurrencyClassName(string lowerClassName)
+    {
+        if(!m_CurrencyClassNames || m_CurrencyClassNamesSource != currencySettings)
+        {
+            m_CurrencyClassNames = new map<string, bool>();
+            m_CurrencyClassNamesSource = currencySettings;
+            if(currencySettings)
+            {
+                foreach(TraderXCurrencyType currencyType : currencySettings.currencyTypes)
+                {
+                    foreach(TraderXCurrency currency : currencyType.currencies)
+                    {
+                        string className = currency.GetCurrencyClassName();
+                        className.ToLower();
+                        m_CurrencyClassNames.Set(className, true);
+                    }
+                }
+            }
+        }
+
+        return m_CurrencyClassNames.Contains(lowerClassName);
+    }
+
     void AddMoneyToPlayer(PlayerBase player, int amount, ref TStringArray acceptedCurrencyTypes = null)
     {
         if(!acceptedCurrencyTypes)
@@ -209,6 +276,10 @@ class TraderXCurrencyService
                     break;
             }
         }
+
+        // New stacks can land inside containers or be merged by the factory, rebuild on the next check
+        if(GetPlayerWallet(player))
+            player.InvalidateTraderXWallet();
     }
 
     /**
@@ -0,0 +1,240 @@
+/**
+ * TraderXPlayerWallet - Server-side index of the money carried by one player
+ * Maps each currency className (lowercase) to the money entities found in the player's inventory.
+ * The index is built with a single inventory enumeration, then kept current from the PlayerBase
+ * inventory hooks so balance checks and payments become lookups instead of inventory scans.
+ * Quantities are read from the indexed entities on demand. Quantity changes that move no entity
+ * (partial sells, payments, stack merges) are reported through OnItemQuantityChanged.
+ */
+class TraderXPlayerWallet
+{
+    private PlayerBase m_Player;
+    private ref map<string, ref array<ItemBase>> m_MoneyByClassName;
+    private TraderXCurrencyTypeCollection m_IndexedSettings;
+    private bool m_IsDirty = true;
+
+    void TraderXPlayerWallet(PlayerBase player)
+    {
+        m_Player = player;
+        m_MoneyByClassName = new map<string, ref array<ItemBase>>();
+    }
+
+    // Forces a full rebuild on the next lookup
+    void Invalidate()
+    {
+        m_IsDirty = true;
+    }
+
+    void OnItemEntered(EntityAI entity)
+    {
+        if (m_IsDirty)
+            return;
+
+        // A container brings its whole content along, rebuild rather than walking it here
+        if (HasChildren(entity))
+        {
+            m_IsDirty = true;
+            return;
+        }
+
+        ItemBase item = ItemBase.Cast(entity);
+        if (!item)
+            return;
+
+        string className = item.GetType();
+        className.ToLower();
+        if (!TraderXCurrencyService.GetInstance().IsCurrencyClassName(className))
+            return;
+
+        array<ItemBase> moneyItems = m_MoneyByClassName.Get(className);
+        if (!moneyItems)
+        {
+            moneyItems = new array<ItemBase>();
+            m_MoneyByClassName.Set(className, moneyItems);
+        }
+
+        if (moneyItems.Find(item) == -1)
+            moneyItems.Insert(item);
+    }
+
+    void OnItemExited(EntityAI entity)
+    {
+        if (m_IsDirty)
+            return;
+
+        if (HasChildren(entity))
+        {
+            m_IsDirty = true;
+            return;
+        }
+
+        ItemBase item = ItemBase.Cast(entity);
+        if (!item)
+            return;
+
+        string className = item.GetType();
+        className.ToLower();
+
+        array<ItemBase> moneyItems = m_MoneyByClassName.Get(className);
+        if (moneyItems)
+            moneyItems.RemoveItem(item);
+    }
+
+    // A stack that ran empty leaves the index, one that was refilled is added back
+    void OnItemQuantityChanged(ItemBase item)
+    {
+        if (m_IsDirty || !item)
+            return;
+
+        if (IsCarried(item) && TraderXQuantityManager.GetItemAmount(item) > 0)
+            OnItemEntered(item);
+        else
+            OnItemExited(item);
+    }
+
+    /**
+     * Total value carried in the given currency type
+     */
+    int GetValue(TraderXCurrencyType currencyType)
+    {
+        EnsureIndexed();
+
+        int amount = 0;
+        foreach (TraderXCurrency currency : currencyType.currencies)
+        {
+            amount += currency.GetCurrencyValue() * GetQuantity(currency.GetCurrencyClassName());
+        }
+        return amount;
+    }
+
+    /**
+     * Quantity carried for one denomination
+     * @param excludeLocked skip the entities TraderXInventoryManager refuses to remove (locked, worn, in a weapon)
+     */
+    int GetQuantity(string className, bool excludeLocked = false)
+    {
+        array<ItemBase> moneyItems = GetMoneyItems(className);
+        if (!moneyItems)
+            return 0;
+
+        int quantity = 0;
+        foreach (ItemBase item : moneyItems)
+        {
+            if (excludeLocked && TraderXItemValidator.ShouldSkipItem(item))
+                continue;
+
+            quantity += TraderXQuantityManager.GetItemAmount(item);
+        }
+        return quantity;
+    }
+
+    /**
+     * Remove a quantity of one denomination from the indexed entities
+     * @return true if the full quantity was removed
+     */
+    bool RemoveMoney(string className, int quantity)
+    {
+        if (quantity <= 0)
+            return true;
+
+        if (GetQuantity(className, true) < quantity)
+            return false;
+
+        // Iterate over a copy, deleted entities leave the index through the hooks
+        array<ItemBase> moneyItems = new array<ItemBase>();
+        moneyItems.Copy(GetMoneyItems(className));
+
+        foreach (ItemBase item : moneyItems)
+        {
+            if (TraderXItemValidator.ShouldSkipItem(item))
+                continue;
+
+            quantity = TraderXInventoryManager.RemoveItem(m_Player, item, quantity);
+            if (quantity <= 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * Live money entities for one denomination, stale entries are pruned on the way
+     */
+    array<ItemBase> GetMoneyItems(string className)
+    {
+        EnsureIndexed();
+
+        string key = className;
+        key.ToLower();
+
+        array<ItemBase> moneyItems = m_MoneyByClassName.Get(key);
+        if (!moneyItems)
+            return null;
+
+        for (int i = moneyItems.Count() - 1; i >= 0; i--)
+        {
+            if (!IsCarried(moneyItems[i]))
+                moneyItems.Remove(i);
+        }
+        return moneyItems;
+    }
+
+    private void EnsureIndexed()
+    {
+        // Currency settings can be swapped at runtime (tests, reload), the index follows them
+        TraderXCurrencyTypeCollection settings = TraderXCurrencyService.GetInstance().currencySettings;
+        if (!m_IsDirty && settings == m_IndexedSettings)
+            return;
+
+        Rebuild(settings);
+    }
+
+    private void Rebuild(TraderXCurrencyTypeCollection settings)
+    {
+        m_MoneyByClassName.Clear();
+        m_IndexedSettings = settings;
+        m_IsDirty = false;
+
+        if (!m_Player)
+            return;
+
+        TraderXCurrencyService currencyService = TraderXCurrencyService.GetInstance();
+        array<EntityAI> itemsArray = TraderXInventoryManager.GetItemsArray(m_Player);
+        foreach (EntityAI entity : itemsArray)
+        {
+            ItemBase item = ItemBase.Cast(entity);
+            if (!item)
+                continue;
+
+            string className = item.GetType();
+            className.ToLower();
+            if (!currencyService.IsCurrencyClassName(className))
+                continue;
+
+            array<ItemBase> moneyItems = m_MoneyByClassName.Get(className);
+            if (!moneyItems)
+            {
+                moneyItems = new array<ItemBase>();
+                m_MoneyByClassName.Set(className, moneyItems);
+            }
+            moneyItems.Insert(item);
+        }
+    }
+
+    private bool IsCarried(ItemBase item)
+    {
+        return item && !item.IsSetForDeletion() && item.GetHierarchyRootPlayer() == m_Player;
+    }
+
+    private bool HasChildren(EntityAI entity)
+    {
+        if (!entity || !entity.GetInventory())
+            return false;
+
+        if (entity.GetInventory().AttachmentCount() > 0)
+            return true;
+
+        CargoBase cargo = entity.GetInventory().GetCargo();
+        return cargo && cargo.GetItemCount() > 0;
+    }
+}
@@ -35,8 +35,8 @@ class CustomizePreviewService
         // Clean up previous preview
         CleanupCurrentPreview();
         
-        // Create new preview entity
-        m_CurrentPreview = EntityAI.Cast(GetGame().CreateObjectEx(item.className, vector.Zero, ECE_LOCAL|ECE_NOLIFETIME));
+        // Take a bare preview entity from the pool
+        m_CurrentPreview = TraderXPreviewEntityPool.GetInstance().Acquire(item.className, new TStringArray());
         m_BaseItem = item;
         
         if (m_CurrentPreview)
@@ -55,7 +55,7 @@ class CustomizePreviewService
     {
         if (m_CurrentPreview)
         {
-            GetGame().ObjectDelete(m_CurrentPreview);
+            TraderXPreviewEntityPool.GetInstance().Release(m_CurrentPreview);
             m_CurrentPreview = null;
         }
         
@@ -85,17 +85,8 @@ class CustomizePreviewService
             return false;
         }
         
-        // Create attachment entity
-        EntityAI attachmentEntity = EntityAI.Cast(GetGame().CreateObjectEx(attachment.className, vector.Zero, ECE_LOCAL|ECE_NOLIFETIME));
-        if (!attachmentEntity)
-        {
-            GetTraderXLogger().LogError("CustomizePreviewService::AddAttachment - Failed to create attachment entity: " + attachment.className);
-            return false;
-        }
-        
-        // Try to attach to preview
-        bool success = TraderXAttachmentHandler.TryAttachItem(m_CurrentPreview, attachmentEntity);
-        if (success)
+        // Create the attachment directly in its slot
+        if (TraderXAttachmentHandler.TryAttachClassName(m_CurrentPreview, attachment.className))
         {
             m_CurrentAttachments.Insert(attachment);
             
@@ -103,11 +94,8 @@ class CustomizePreviewService
             Event_OnPreviewUpdated.Invoke(m_CurrentPreview);
             return true;
         }
-        else
-        {
-            GetGame().ObjectDelete(attachmentEntity);
-            return false;
-        }
+        
+        return false;
     }
     
     bool RemoveAttachment(TraderXProduct attachment)
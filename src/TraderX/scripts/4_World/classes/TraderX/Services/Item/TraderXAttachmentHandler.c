@@ -24,6 +24,11 @@ class TraderXAttachmentHandler
     }
 
     static bool CanAttachToSlot(ItemBase attachment, string slotName)
+    {
+        return CanClassAttachToSlot(attachment.GetType(), slotName);
+    }
+
+    static bool CanClassAttachToSlot(string attachmentClassName, string slotName)
     {
         TStringArray searching_in = new TStringArray;
 		searching_in.Insert(CFG_VEHICLESPATH);
@@ -33,7 +38,7 @@ class TraderXAttachmentHandler
         foreach (string path : searching_in)
         {
             TStringArray slotNames = new TStringArray();
-            GetGame().ConfigGetTextArray(path + " " + attachment.GetType() + " inventorySlot", slotNames);
+            GetGame().ConfigGetTextArray(path + " " + attachmentClassName + " inventorySlot", slotNames);
 
             foreach(string slot : slotNames)
             {
@@ -45,15 +50,24 @@ class TraderXAttachmentHandler
         return false;
     }
 
+    // The attachment is created in the parent's inventory from the type of newAttachment, newAttachment itself is not moved
     static bool TryAttachItem(EntityAI parent, EntityAI newAttachment)
+    {
+        if(!newAttachment)
+            return false;
+
+        return TryAttachClassName(parent, newAttachment.GetType()) != null;
+    }
+
+    // Create an attachment of the given type in the first compatible slot, replacing what is there
+    static EntityAI TryAttachClassName(EntityAI parent, string className)
     {
         EntityAI createdEntity;
-        bool hasBeenAdded = false;
         array<string> slotNames = GetAttachmentSlots(parent);
         for (int i = 0; i < slotNames.Count(); i++)
         {
             string slotName = slotNames[i];
-            if (CanAttachToSlot(newAttachment, slotName))
+            if (CanClassAttachToSlot(className, slotName))
             {
                 EntityAI existingAttachment = parent.FindAttachmentBySlotName(slotName);
                 if (existingAttachment)
@@ -63,24 +77,21 @@ class TraderXAttachmentHandler
                 }
 
                 Weapon_Base wpn = Weapon_Base.Cast(parent);
-                if(wpn && newAttachment && newAttachment.IsInherited(Magazine) && !newAttachment.IsInherited(Ammunition_Base))
+                if(wpn && GetGame().IsKindOf(className, "Magazine") && !GetGame().IsKindOf(className, "Ammunition_Base"))
                 {
                     // Attach new mag
-                    createdEntity = wpn.SpawnAttachedMagazine(newAttachment.GetType());
+                    createdEntity = wpn.SpawnAttachedMagazine(className);
                 }
                 else
                 {
                     // Attach new item
-                    createdEntity = parent.GetInventory().CreateAttachment(newAttachment.GetType());
+                    createdEntity = parent.GetInventory().CreateAttachment(className);
                 }
                 break;
             }
         }
 
-        if(createdEntity)
-            hasBeenAdded = true;
-
-        return hasBeenAdded;
+        return createdEntity;
     }
 
   static array<EntityAI> GetAttachments(EntityAI item)
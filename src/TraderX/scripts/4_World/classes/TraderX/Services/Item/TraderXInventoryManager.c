@@ -128,6 +128,8 @@ class TraderXInventoryManager
 
       GetTraderXLogger().LogDebug(string.Format("Remove item 1"));
   
+        if (player)
+          player.OnTraderXItemInventoryOut(item);
         GetGame().ObjectDelete(item);
         quantity--;
     }
@@ -144,6 +146,8 @@ class TraderXInventoryManager
       else
       {
         quantity -= itemAmount;
+        if (player)
+          player.OnTraderXItemInventoryOut(item);
         GetGame().ObjectDelete(item);
       }
     }
@@ -180,12 +184,11 @@ class TraderXInventoryManager
 
   static string GetSlotForPlayerPreview(string className)
   {
-    TStringArray classnameArr = new TStringArray;
-    string Vpath = CFG_VEHICLESPATH + " " + className + " inventorySlot";
-    if ( GetGame().ConfigIsExisting( Vpath ) )
-        g_Game.ConfigGetTextArray( Vpath , classnameArr);
+    TraderXClassMetadata metadata = TraderXClassMetadataCache.Get(className);
+    if(metadata.configPath != CFG_VEHICLESPATH)
+      return string.Empty;
 
-    foreach(string classname: classnameArr)
+    foreach(string classname: metadata.inventorySlots)
     {
       foreach(int idx, string playerAtt: StaticTraderXCoreLists.playerAttachments)
       {
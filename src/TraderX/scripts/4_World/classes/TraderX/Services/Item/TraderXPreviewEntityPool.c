@@ -0,0 +1,241 @@
+/**
+ * TraderXPreviewEntityPool - Client side pool of the local entities shown in item previews
+ * Released previews stay idle, attachments included, and are handed out again for the same className.
+ * Acquiring with a list of attachments only adds and removes the difference, so a preview that comes
+ * back with the same attachments costs nothing. Idle previews are evicted least recently used first
+ * once they hold more than MAX_IDLE_ENTITIES entities, attachments counted. Cleared when the trader closes.
+ */
+class TraderXPreviewEntityPool
+{
+    static const int MAX_IDLE_ENTITIES = 96;
+
+    private static ref TraderXPreviewEntityPool m_Instance;
+
+    // Least recently released first, m_IdleWeights holds the entity count of each preview
+    private ref array<EntityAI> m_Idle;
+    private ref TIntArray m_IdleWeights;
+    private int m_IdleEntityCount;
+
+    private int m_CreatedCount;
+    private int m_ReusedCount;
+    private int m_EvictedCount;
+
+    void TraderXPreviewEntityPool()
+    {
+        m_Idle = new array<EntityAI>();
+        m_IdleWeights = new TIntArray();
+    }
+
+    void ~TraderXPreviewEntityPool()
+    {
+        Clear();
+    }
+
+    static TraderXPreviewEntityPool GetInstance()
+    {
+        if (!m_Instance)
+            m_Instance = new TraderXPreviewEntityPool();
+        return m_Instance;
+    }
+
+    /**
+     * Get a preview entity of className at position
+     * @param attachmentClassNames attachments the preview must carry, null keeps whatever a reused preview has
+     */
+    EntityAI Acquire(string className, TStringArray attachmentClassNames = null, vector position = "0 0 0")
+    {
+        EntityAI entity = TakeIdle(className, attachmentClassNames);
+        if (entity)
+        {
+            m_ReusedCount++;
+            entity.SetPosition(position);
+        }
+        else
+        {
+            entity = EntityAI.Cast(GetGame().CreateObjectEx(className, position, ECE_LOCAL|ECE_NOLIFETIME));
+            if (!entity)
+                return null;
+
+            m_CreatedCount++;
+        }
+
+        if (attachmentClassNames)
+            ResetAttachments(entity, attachmentClassNames);
+
+        return entity;
+    }
+
+    // Hand a preview back, it must not be displayed or modified by the caller anymore
+    void Release(EntityAI entity)
+    {
+        if (!entity || m_Idle.Find(entity) != -1)
+            return;
+
+        // Only root previews are pooled, a detached attachment handed back is deleted
+        if (entity.GetHierarchyParent())
+        {
+            GetGame().ObjectDelete(entity);
+            return;
+        }
+
+        int weight = CountEntities(entity);
+        m_Idle.Insert(entity);
+        m_IdleWeights.Insert(weight);
+        m_IdleEntityCount += weight;
+
+        while (m_IdleEntityCount > MAX_IDLE_ENTITIES && m_Idle.Count() > 0)
+        {
+            EvictOldest();
+        }
+    }
+
+    void Clear()
+    {
+        foreach (EntityAI entity : m_Idle)
+        {
+            if (entity)
+                GetGame().ObjectDelete(entity);
+        }
+
+        m_Idle.Clear();
+        m_IdleWeights.Clear();
+        m_IdleEntityCount = 0;
+
+        GetTraderXLogger().LogDebug(string.Format("[PREVIEW] Pool cleared: %1 created, %2 reused, %3 evicted", m_CreatedCount, m_ReusedCount, m_EvictedCount));
+    }
+
+    int GetIdleCount()
+    {
+        return m_Idle.Count();
+    }
+
+    /**
+     * Make the preview carry exactly these attachments
+     * Attachments already in place are kept, the others are deleted, the missing ones are created.
+     * Players also lose what they hold in hands.
+     */
+    static void ResetAttachments(EntityAI entity, TStringArray attachmentClassNames)
+    {
+        TStringArray missing = new TStringArray();
+        missing.Copy(attachmentClassNames);
+
+        array<EntityAI> attachments = new array<EntityAI>();
+        for (int i = 0; i < entity.GetInventory().AttachmentCount(); i++)
+        {
+            attachments.Insert(entity.GetInventory().GetAttachmentFromIndex(i));
+        }
+
+        foreach (EntityAI attachment : attachments)
+        {
+            int index = FindClassName(missing, attachment.GetType());
+            if (index != -1)
+                missing.Remove(index);
+            else
+                GetGame().ObjectDelete(attachment);
+        }
+
+        Man man = Man.Cast(entity);
+        if (man && man.GetHumanInventory().GetEntityInHands())
+            GetGame().ObjectDelete(man.GetHumanInventory().GetEntityInHands());
+
+        foreach (string className : missing)
+        {
+            // Players have no attachments config, the inventory picks the clothing slot itself
+            if (man)
+                entity.GetInventory().CreateAttachment(className);
+            else
+                TraderXAttachmentHandler.TryAttachClassName(entity, className);
+        }
+    }
+
+    static bool HasAttachment(EntityAI entity, string className)
+    {
+        for (int i = 0; i < entity.GetInventory().AttachmentCount(); i++)
+        {
+            if (CF_String.EqualsIgnoreCase(entity.GetInventory().GetAttachmentFromIndex(i).GetType(), className))
+                return true;
+        }
+        return false;
+    }
+
+    // Most recently released preview of className, one already carrying the wanted attachments first
+    private EntityAI TakeIdle(string className, TStringArray attachmentClassNames)
+    {
+        int match = -1;
+        for (int i = m_Idle.Count() - 1; i >= 0; i--)
+        {
+            EntityAI entity = m_Idle[i];
+            if (!entity || !CF_String.EqualsIgnoreCase(entity.GetType(), className))
+                continue;
+
+            if (match == -1)
+                match = i;
+
+            if (!attachmentClassNames || HasExactAttachments(entity, attachmentClassNames))
+            {
+                match = i;
+                break;
+            }
+        }
+
+        if (match == -1)
+            return null;
+
+        EntityAI idle = m_Idle[match];
+        m_IdleEntityCount -= m_IdleWeights[match];
+        m_Idle.RemoveOrdered(match);
+        m_IdleWeights.RemoveOrdered(match);
+        return idle;
+    }
+
+    private void EvictOldest()
+    {
+        EntityAI oldest = m_Idle[0];
+        m_IdleEntityCount -= m_IdleWeights[0];
+        m_Idle.RemoveOrdered(0);
+        m_IdleWeights.RemoveOrdered(0);
+
+        if (oldest)
+            GetGame().ObjectDelete(oldest);
+
+        m_EvictedCount++;
+    }
+
+    private static bool HasExactAttachments(EntityAI entity, TStringArray attachmentClassNames)
+    {
+        if (entity.GetInventory().AttachmentCount() != attachmentClassNames.Count())
+            return false;
+
+        TStringArray remaining = new TStringArray();
+        remaining.Copy(attachmentClassNames);
+        for (int i = 0; i < entity.GetInventory().AttachmentCount(); i++)
+        {
+            int index = FindClassName(remaining, entity.GetInventory().GetAttachmentFromIndex(i).GetType());
+            if (index == -1)
+                return false;
+
+            remaining.Remove(index);
+        }
+        return true;
+    }
+
+    private static int FindClassName(TStringArray classNames, string className)
+    {
+        foreach (int i, string candidate : classNames)
+        {
+            if (CF_String.EqualsIgnoreCase(candidate, className))
+                return i;
+        }
+        return -1;
+    }
+
+    private static int CountEntities(EntityAI entity)
+    {
+        array<EntityAI> entities = new array<EntityAI>();
+        entity.GetInventory().EnumerateInventory(InventoryTraversalType.PREORDER, entities);
+        if (entities.Count() == 0)
+            return 1;
+
+        return entities.Count();
+    }
+}
@@ -22,6 +22,7 @@ class TraderXQuantityManager
         mag.ServerSetAmmoCount(mag.GetAmmoCount() + quantity);
     else
       item.SetQuantity((QuantityConversions.GetItemQuantity(item) + quantity));
+    NotifyQuantityChanged(item);
     return item;
   }
 
@@ -32,9 +33,21 @@ class TraderXQuantityManager
         mag.ServerSetAmmoCount(amount);
     else
       item.SetQuantity(amount);
+    NotifyQuantityChanged(item);
     return item;
   }
 
+  // No entity moves on a quantity change, the carrier's wallet is told directly
+  static void NotifyQuantityChanged(ItemBase item)
+  {
+    if (!item)
+      return;
+
+    PlayerBase player = PlayerBase.Cast(item.GetHierarchyRootPlayer());
+    if (player)
+      player.OnTraderXItemQuantityChanged(item);
+  }
+
   static int GetItemVolumePerCent(ItemBase item)
   {
     int currentVolume = TraderXQuantityManager.GetItemAmount(item);
@@ -73,26 +86,7 @@ class TraderXQuantityManager
 
   static int GetMaxItemQuantityServer(string className)
   {
-    EntityAI ent = EntityAI.Cast(GetGame().CreateObject(className , "0 0 0"));
-    if(!ent)
-      return 0;
-
-    ItemBase item;
-    if(Class.CastTo(item, ent))
-    {
-      float currentQuantity, minQuantity, maxQuantity;
-      QuantityConversions.GetItemQuantity(item, currentQuantity, minQuantity, maxQuantity);
-
-      if(maxQuantity == 0){
-        maxQuantity = 1;
-      }
-            
-      GetGame().ObjectDelete(item);
-      return maxQuantity;
-    }
-
-    GetGame().ObjectDelete(ent);
-    return 0;
+    return TraderXClassMetadataCache.GetMaxQuantity(className);
   }
 
   static bool ContainsIgnoreCase(string source, string key)
@@ -253,17 +247,7 @@ class TraderXQuantityManager
 
   static bool IsMagazine(string className)
   {
-    bool isMag = false;
-    ItemBase item = ItemBase.Cast(GetGame().CreateObject(className, vector.Zero));
-    Magazine mag;
-    Ammunition_Base ammo;
-
-    if(CastTo(mag, item) && !CastTo(ammo, item))
-      isMag = true;
-
-    GetGame().ObjectDelete(item);
-
-    return isMag;
+    return TraderXClassMetadataCache.IsMagazine(className);
   }
 
   static int GetTotalQuantityOfItem(PlayerBase player, string className, int health = TraderXProductState.ALL_STATE)
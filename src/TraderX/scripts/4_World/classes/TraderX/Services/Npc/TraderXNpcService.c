@@ -31,34 +31,40 @@ class TraderXNpcService
         GetTraderXLogger().LogDebug("[TraderX] CreateNpcs initiated");
         foreach(TraderXNpc npc: GetTraderXModule().GetSettings().traders)
         {
-            npcs.Insert(npc.npcId, npc);
-            Object obj = GetGame().CreateObject(npc.className, vector.Zero, false, false);
-            if (!obj)
-            {
-                GetTraderXLogger().LogDebug("[TraderX] obj was not created: "+ npc.className + " please make sure the syntaxe is correct!");
-                continue;
-            }
+            CreateNpc(npc);
+        }
+    }
 
-            PlayerBase traderPlayer = PlayerBase.Cast(obj);
-            if (traderPlayer)
-            {
-                GetTraderXLogger().LogDebug("[TraderX] traderPlayer created and added!: ");
-                traderPlayer.SetupTraderXNpc(npc);
-                traderPlayer.SetTraderNpc();
-                continue;
-            }
+    // Spawn a single trader, the server startup creates them a few per frame
+    void CreateNpc(TraderXNpc npc)
+    {
+        npcs.Insert(npc.npcId, npc);
+        Object obj = GetGame().CreateObject(npc.className, vector.Zero, false, false);
+        if (!obj)
+        {
+            GetTraderXLogger().LogDebug("[TraderX] obj was not created: "+ npc.className + " please make sure the syntaxe is correct!");
+            return;
+        }
 
-            BuildingBase traderBuilding = BuildingBase.Cast(obj);
-            if (traderBuilding)
-            {
-                GetTraderXLogger().LogDebug("[TraderX] traderStatic created and added!: ");
-                traderBuilding.SetupTraderXNpc(npc);
-                traderBuilding.SetTraderNpc();
-            }
-            else
-            {
-                GetTraderXLogger().LogDebug("[TraderX] traderStatic was NOT created ! Make sure your static object extends BuildingBase as the documentation tells you!");
-            }
+        PlayerBase traderPlayer = PlayerBase.Cast(obj);
+        if (traderPlayer)
+        {
+            GetTraderXLogger().LogDebug("[TraderX] traderPlayer created and added!: ");
+            traderPlayer.SetupTraderXNpc(npc);
+            traderPlayer.SetTraderNpc();
+            return;
+        }
+
+        BuildingBase traderBuilding = BuildingBase.Cast(obj);
+        if (traderBuilding)
+        {
+            GetTraderXLogger().LogDebug("[TraderX] traderStatic created and added!: ");
+            traderBuilding.SetupTraderXNpc(npc);
+            traderBuilding.SetTraderNpc();
+        }
+        else
+        {
+            GetTraderXLogger().LogDebug("[TraderX] traderStatic was NOT created ! Make sure your static object extends BuildingBase as the documentation tells you!");
         }
     }
 }
@@ -24,7 +24,8 @@ class TraderXNpcSessionService
             playersPerNpc.Insert(npcId, new array<PlayerBase>());
         }
         
-        playersPerNpc[npcId].Insert(player);
+        if (playersPerNpc[npcId].Find(player) == -1)
+            playersPerNpc[npcId].Insert(player);
     }
 
     void RemovePlayerFromNpcId(PlayerBase player, int npcId)
@@ -64,25 +65,89 @@ class TraderXNpcSessionService
         playersPerNpc.Set(npcId, players);
     }
 
-    void SendStockResponses(array<ref TraderXProductStock> itemsStock, int npcId)
+    /**
+     * Send the stock changes of this frame to every open trader session
+     * Changes are merged per npc and sent once as parallel arrays (catalog index, new stock)
+     * along with the npc id and the stock version they bring the client up to
+     */
+    void BroadcastStockChanges()
     {
-        if (!playersPerNpc.Contains(npcId))
+        if (!TraderXProductStockRepository.HasStockChanges())
             return;
-        
-        array<PlayerBase> players = playersPerNpc[npcId];
-        if(!players){
-            GetTraderXLogger().LogError("SendStockResponses: No players found for npcId: " + npcId);
+
+        map<string, int> changes = TraderXProductStockRepository.TakeStockChanges();
+        if (playersPerNpc.Count() == 0)
             return;
+
+        TraderXCatalogService catalogService = TraderXCatalogService.GetInstance();
+        array<int> staleNpcIds = new array<int>();
+        foreach (int npcId, array<PlayerBase> players : playersPerNpc)
+        {
+            if (!players || players.Count() == 0)
+                continue;
+
+            map<string, bool> npcProductIds = GetNpcProductIds(npcId);
+            if (!npcProductIds)
+                continue;
+
+            TIntArray productIndexes = new TIntArray();
+            TIntArray stocks = new TIntArray();
+            foreach (string productId, int stock : changes)
+            {
+                if (!npcProductIds.Contains(productId))
+                    continue;
+
+                int productIndex = catalogService.GetProductIndex(productId);
+                if (productIndex == -1)
+                    continue;
+
+                productIndexes.Insert(productIndex);
+                stocks.Insert(stock);
+            }
+
+            if (productIndexes.Count() == 0)
+                continue;
+
+            if (!SendStockDelta(npcId, players, productIndexes, stocks))
+                staleNpcIds.Insert(npcId);
         }
 
-        foreach(PlayerBase player: players)
+        // Sessions are pruned once the iteration over them is over
+        foreach (int staleNpcId : staleNpcIds)
         {
-            if(!player)
+            RefreshPlayers(staleNpcId);
+        }
+    }
+
+    // @return false when the session holds players that left
+    private bool SendStockDelta(int npcId, array<PlayerBase> players, TIntArray productIndexes, TIntArray stocks)
+    {
+        // The version lets clients skip these products when they reopen the menu later
+        int version = TraderXProductStockRepository.GetStockVersion();
+        Param4<int, int, TIntArray, TIntArray> delta = new Param4<int, int, TIntArray, TIntArray>(npcId, version, productIndexes, stocks);
+        bool hasStalePlayer = false;
+
+        foreach (PlayerBase player : players)
+        {
+            if (!player || !player.GetIdentity())
+            {
+                hasStalePlayer = true;
                 continue;
+            }
 
-            GetRPCManager().SendRPC("TraderX", "GetTraderStockResponse", new Param1<array<ref TraderXProductStock>>(itemsStock), true, player.GetIdentity());
+            GetRPCManager().SendRPC("TraderX", "OnStockDeltaResponse", delta, true, player.GetIdentity());
         }
 
-        RefreshPlayers(npcId);
+        return !hasStalePlayer;
+    }
+
+    // productId set of the npc, used to route stock deltas to the sessions that display the product
+    map<string, bool> GetNpcProductIds(int npcId)
+    {
+        TraderXNpcTradeView npcView = TraderXNpcTradeViewRepository.GetView(npcId);
+        if (!npcView)
+            return null;
+
+        return npcView.GetProductIds();
     }
 }
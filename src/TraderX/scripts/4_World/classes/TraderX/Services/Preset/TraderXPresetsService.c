@@ -6,10 +6,19 @@ class TraderXPresetsService
     ref map<string, ref TraderXPresets> m_serverPresets; // Server presets (admin-configured)
     string filePath;
 
+    // Compiled presets and their prices for the current stock version, keyed by preset content since
+    // the server prices presets sent by clients. Both are dropped once they hold MAX_CACHED_PRESETS entries
+    static const int MAX_CACHED_PRESETS = 512;
+    private ref map<string, ref TraderXPresetBillOfMaterials> m_BillOfMaterialsByContent;
+    private ref map<string, int> m_PriceCache;
+    private int m_PriceCacheStockVersion;
+
     void TraderXPresetsService()
     {
         m_presets = new map<string, ref TraderXPresets>();
         m_serverPresets = new map<string, ref TraderXPresets>();
+        m_BillOfMaterialsByContent = new map<string, ref TraderXPresetBillOfMaterials>();
+        m_PriceCache = new map<string, int>();
         
         // Server-side initialization
         if (GetGame().IsServer())
@@ -62,94 +71,144 @@ class TraderXPresetsService
 
     int CalculateTotalPricePreset(TraderXPreset preset)
     {
+        int cachedPrice;
+        string cacheKey = GetPriceCacheKey(preset, 1);
+        if (TryGetCachedPrice(cacheKey, cachedPrice))
+            return cachedPrice;
+
+        TraderXPresetBillOfMaterials bom = GetBillOfMaterials(preset);
         int totalPrice = 0;
         
-        // Use dynamic pricing for main item
-        TraderXProduct item = TraderXProductRepository.GetItemById(preset.productId);
-        if (item) {
-            int mainItemPrice = TraderXPricingService.GetInstance().GetPricePreview(preset.productId, true, 1, TraderXItemState.PRISTINE);
-            totalPrice += mainItemPrice;
-        }
-        
-        // Add attachment prices
-        for (int i = 0; i < preset.attachments.Count(); i++) {
-            string attachmentId = preset.attachments.Get(i);
-            TraderXProduct attachmentProduct = TraderXProductRepository.GetItemById(attachmentId);
-            if (attachmentProduct) {
-                int attachmentPrice = TraderXPricingService.GetInstance().GetPricePreview(attachmentId, true, 1, TraderXItemState.PRISTINE);
-                totalPrice += attachmentPrice;
-            }
+        // Dynamic price of each distinct product, once per occurrence in the preset
+        for (int i = 0; i < bom.Count(); i++) {
+            string productId = bom.productIds[i];
+            if (!TraderXProductRepository.GetItemById(productId))
+                continue;
+
+            totalPrice += TraderXPricingService.GetInstance().GetPricePreview(productId, true, 1, TraderXItemState.PRISTINE) * bom.counts[i];
         }
 
+        SetCachedPrice(cacheKey, totalPrice);
         return totalPrice;
     }
     
     // Calculate progressive preset pricing for multiple units (buy mode)
+    // Each unit is priced one stock level lower than the previous one for every component
     int CalculateProgressivePresetPrice(TraderXPreset preset, int multiplier)
     {
         if (multiplier <= 1) {
             return CalculateTotalPricePreset(preset);
         }
         
-        // Use the pricing service to calculate progressive pricing for the entire preset
-        // This ensures consistency with the main pricing logic
         TraderXProduct mainProduct = TraderXProductRepository.GetItemById(preset.productId);
         if (!mainProduct) {
             return -1;
         }
+
+        int cachedPrice;
+        string cacheKey = GetPriceCacheKey(preset, multiplier);
+        if (TryGetCachedPrice(cacheKey, cachedPrice))
+            return cachedPrice;
         
-        // Calculate progressive pricing by summing individual unit prices
-        // Each unit is calculated with decreasing stock levels for all components
+        // One aggregated progressive computation per distinct product of the preset
+        TraderXPresetBillOfMaterials bom = GetBillOfMaterials(preset);
         int totalPrice = 0;
         
-        for (int i = 0; i < multiplier; i++) {
-            // Calculate main item price at current stock level (decreases with each unit)
-            TraderXPriceCalculation mainItemCalc = TraderXPricingService.GetInstance().CalculateBuyPrice(mainProduct, 1, TraderXItemState.PRISTINE);
-            
-            // Manually adjust for stock decrease - simulate buying i units already
-            int currentMainStock = TraderXProductStockRepository.GetStockAmount(preset.productId);
-            int effectiveMainStock = currentMainStock - i;
-            
-            int mainItemPrice;
-            if (mainProduct.IsStockUnlimited() || mainProduct.coefficient == 1.0) {
-                mainItemPrice = mainProduct.buyPrice;
-            } else {
-                mainItemPrice = Math.Pow(mainProduct.coefficient, Math.Max(0, effectiveMainStock - 1)) * mainProduct.buyPrice;
-            }
-            
-            int presetUnitPrice = mainItemPrice;
-            
-            // Add attachment prices with progressive stock decrease
-            for (int j = 0; j < preset.attachments.Count(); j++) {
-                string attachmentId = preset.attachments.Get(j);
-                TraderXProduct attachmentProduct = TraderXProductRepository.GetItemById(attachmentId);
-                if (attachmentProduct) {
-                    int currentAttachmentStock = TraderXProductStockRepository.GetStockAmount(attachmentId);
-                    int effectiveAttachmentStock = currentAttachmentStock - i;
-                    
-                    int attachmentPrice;
-                    if (attachmentProduct.IsStockUnlimited() || attachmentProduct.coefficient == 1.0) {
-                        attachmentPrice = attachmentProduct.buyPrice;
-                    } else {
-                        attachmentPrice = Math.Pow(attachmentProduct.coefficient, Math.Max(0, effectiveAttachmentStock - 1)) * attachmentProduct.buyPrice;
-                    }
-                    
-                    presetUnitPrice += attachmentPrice;
-                }
-            }
-            
-            totalPrice += presetUnitPrice;
-            
-            GetTraderXLogger().LogDebug(string.Format("[PRESET_PRICING] Unit %1/%2: MainStock=%3, UnitPrice=%4, RunningTotal=%5", 
-                (i + 1), multiplier, effectiveMainStock, presetUnitPrice, totalPrice));
+        for (int i = 0; i < bom.Count(); i++) {
+            TraderXProduct product = TraderXProductRepository.GetItemById(bom.productIds[i]);
+            if (!product)
+                continue;
+
+            totalPrice += GetDescendingStockPrice(product, multiplier) * bom.counts[i];
         }
         
         GetTraderXLogger().LogDebug(string.Format("[PRESET_PRICING] Progressive preset total: %1 for %2 units of %3", 
             totalPrice, multiplier, preset.presetName));
         
+        SetCachedPrice(cacheKey, totalPrice);
         return totalPrice;
     }
 
+    /**
+     * Sum over units i = 0..multiplier-1 of c^max(0, stock - 1 - i) * buyPrice, each unit truncated to int
+     * like the single unit price. Units at or below stock 1 all cost buyPrice and are counted in one go.
+     */
+    private int GetDescendingStockPrice(TraderXProduct product, int multiplier)
+    {
+        if (product.IsStockUnlimited() || product.coefficient == 1.0)
+            return multiplier * product.buyPrice;
+
+        int stock = TraderXProductStockRepository.GetStockAmount(product.GetProductId());
+        int progressiveUnits = stock - 1;
+        if (progressiveUnits < 0)
+            progressiveUnits = 0;
+        if (progressiveUnits > multiplier)
+            progressiveUnits = multiplier;
+
+        int totalPrice = (multiplier - progressiveUnits) * product.buyPrice;
+        for (int i = 0; i < progressiveUnits; i++)
+        {
+            int unitPrice = Math.Pow(product.coefficient, stock - 1 - i) * product.buyPrice;
+            totalPrice += unitPrice;
+        }
+        return totalPrice;
+    }
+
+    private TraderXPresetBillOfMaterials GetBillOfMaterials(TraderXPreset preset)
+    {
+        string contentKey = TraderXPresetBillOfMaterials.GetContentKey(preset);
+        TraderXPresetBillOfMaterials bom = m_BillOfMaterialsByContent.Get(contentKey);
+        if (!bom)
+        {
+            if (m_BillOfMaterialsByContent.Count() >= MAX_CACHED_PRESETS)
+                m_BillOfMaterialsByContent.Clear();
+
+            bom = TraderXPresetBillOfMaterials.Compile(preset);
+            m_BillOfMaterialsByContent.Set(contentKey, bom);
+        }
+        return bom;
+    }
+
+    // Prices only move with stock or configuration, the cache is dropped whenever the stock version changes
+    private bool TryGetCachedPrice(string cacheKey, out int price)
+    {
+        if (cacheKey == string.Empty)
+            return false;
+
+        int stockVersion = TraderXProductStockRepository.GetStockVersion();
+        if (stockVersion != m_PriceCacheStockVersion)
+        {
+            m_PriceCache.Clear();
+            m_PriceCacheStockVersion = stockVersion;
+            return false;
+        }
+
+        return m_PriceCache.Find(cacheKey, price);
+    }
+
+    private void SetCachedPrice(string cacheKey, int price)
+    {
+        if (cacheKey == string.Empty)
+            return;
+
+        if (m_PriceCache.Count() >= MAX_CACHED_PRESETS)
+            m_PriceCache.Clear();
+
+        m_PriceCache.Set(cacheKey, price);
+    }
+
+    private string GetPriceCacheKey(TraderXPreset preset, int multiplier)
+    {
+        return TraderXPresetBillOfMaterials.GetContentKey(preset) + ":" + multiplier;
+    }
+
+    // Configuration reload: product prices and presets may have changed
+    void InvalidatePriceCache()
+    {
+        m_PriceCache.Clear();
+        m_BillOfMaterialsByContent.Clear();
+    }
+
     TraderXPreset GetPresetFromMainItemAndPresetId(TraderXProduct item, string presetId)
     {
         array<ref TraderXPreset> presets = GetPresets(item.productId);
@@ -406,6 +465,7 @@ class TraderXPresetsService
         
         // Store received server presets in local cache for client-side access
         m_serverPresets.Set(productId, serverPresets);
+        InvalidatePriceCache();
     }
 
     void OnAllServerPresetsResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
@@ -429,6 +489,7 @@ class TraderXPresetsService
         foreach (TraderXPresets presets : allPresets) {
             m_serverPresets.Set(presets.productId, presets);
         }
+        InvalidatePriceCache();
     }
 
     void OnPlayerJoined(PlayerBase player, PlayerIdentity identity)
@@ -15,8 +15,11 @@ class TraderXConfigurationService
         return s_Instance;
     }
     
-    // Main entry point: Initialize configuration based on user preferences
-    void Initialize(TraderXSourceConfig sourceConfig)
+    /**
+     * Migrate and compile the sources the selected format needs, nothing is loaded yet
+     * BeginCatalogLoad then reads the result, the mapping runs a slice per frame from the startup.
+     */
+    void PrepareConfiguration(TraderXSourceConfig sourceConfig)
     {
         ETraderXSourceFormat format = sourceConfig.GetFormatEnum();
         
@@ -26,34 +29,49 @@ class TraderXConfigurationService
         switch (format)
         {
             case ETraderXSourceFormat.LEGACY:
-                LoadLegacyConfiguration();
+                GetTraderXLogger().LogInfo("[TraderX] Loading configuration using LEGACY format (individual JSON files)");
                 break;
                 
             case ETraderXSourceFormat.CSV:
-                LoadCsvConfiguration(sourceConfig);
+                PrepareCsvConfiguration(sourceConfig);
                 break;
                 
             case ETraderXSourceFormat.COMPILED:
-                LoadCompiledConfiguration(sourceConfig);
+                PrepareCompiledConfiguration(sourceConfig);
+                break;
+                
+            case ETraderXSourceFormat.BINARY:
+                PrepareBinaryConfiguration(sourceConfig);
                 break;
         }
     }
     
-    // Load configuration using LEGACY format (individual JSON files)
-    private void LoadLegacyConfiguration()
+    // Read the catalog source of the selected format, the cursor fills the repositories
+    TraderXCatalogLoadCursor BeginCatalogLoad(TraderXSourceConfig sourceConfig)
+    {
+        TraderXCatalogLoadCursor cursor = new TraderXCatalogLoadCursor();
+        cursor.Begin(sourceConfig.GetFormatEnum() == ETraderXSourceFormat.BINARY);
+        return cursor;
+    }
+    
+    // Parkings are small and loaded whole once products and categories are in
+    void CompleteCatalogLoad()
     {
-        GetTraderXLogger().LogInfo("[TraderX] Loading configuration using LEGACY format (individual JSON files)");
-        
-        TraderXProductRepository.LoadAllProducts();
-        TraderXCategoryRepository.LoadAllCategories();
         TraderXVehicleParkingRepository.LoadAllParkingCollections();
-        ApplyStockBehaviorAtRestart();
         
-        GetTraderXLogger().LogInfo("[TraderX] Legacy configuration loaded successfully");
+        GetTraderXLogger().LogInfo(string.Format("[TraderX] Configuration loaded: %1 products, %2 categories", TraderXProductRepository.GetProductCount(), TraderXCategoryRepository.GetCategoryCount()));
     }
     
-    // Load configuration using CSV format (Source/*.csv files)
-    private void LoadCsvConfiguration(TraderXSourceConfig sourceConfig)
+    void PublishCatalog()
+    {
+        // Serialize the catalog once now, every joining player gets the same payload
+        TraderXCatalogService.GetInstance().RebuildCatalog();
+        GetTraderXModule().RebuildNpcTradeViews();
+        TraderXPresetsService.GetInstance().InvalidatePriceCache();
+    }
+    
+    // CSV format (Source/*.csv files), compiled to JSON before loading
+    private void PrepareCsvConfiguration(TraderXSourceConfig sourceConfig)
     {
         GetTraderXLogger().LogInfo("[TraderX] Loading configuration using CSV format");
         
@@ -88,18 +106,10 @@ class TraderXConfigurationService
                 GetTraderXLogger().LogWarning("[TraderX] CSV compilation failed or used backup. Check ConfigReport.log for details.");
             }
         }
-        
-        // Load from compiled JSON (which was just created from CSV)
-        TraderXProductRepository.LoadAllProducts();
-        TraderXCategoryRepository.LoadAllCategories();
-        TraderXVehicleParkingRepository.LoadAllParkingCollections();
-        ApplyStockBehaviorAtRestart();
-        
-        GetTraderXLogger().LogInfo("[TraderX] CSV configuration loaded successfully");
     }
     
-    // Load configuration using COMPILED format (Compiled/*.json files)
-    private void LoadCompiledConfiguration(TraderXSourceConfig sourceConfig)
+    // COMPILED format (Compiled/*.json files), created from CSV or legacy when missing
+    private void PrepareCompiledConfiguration(TraderXSourceConfig sourceConfig)
     {
         GetTraderXLogger().LogInfo("[TraderX] Loading configuration using COMPILED format");
         
@@ -130,32 +140,91 @@ class TraderXConfigurationService
                 GetTraderXLogger().LogInfo("[TraderX] Migration/Compilation complete. autoMigrate automatically disabled to prevent re-conversion.");
             }
         }
+    }
+    
+    // BINARY format (Compiled/Catalog_compiled.bin, built from Source/)
+    private void PrepareBinaryConfiguration(TraderXSourceConfig sourceConfig)
+    {
+        GetTraderXLogger().LogInfo("[TraderX] Loading configuration using BINARY format");
         
-        // Load from compiled JSON
-        TraderXProductRepository.LoadAllProducts();
-        TraderXCategoryRepository.LoadAllCategories();
-        TraderXVehicleParkingRepository.LoadAllParkingCollections();
-        ApplyStockBehaviorAtRestart();
-        
-        GetTraderXLogger().LogInfo("[TraderX] Compiled configuration loaded successfully");
+        // Sources stay the editable copy, the compiler skips itself when nothing changed
+        if (sourceConfig.allowCompilation && HasSourceFiles())
+        {
+            if (!TraderXConfigCompiler.CompileAndValidate())
+            {
+                GetTraderXLogger().LogWarning("[TraderX] CSV compilation failed or used backup. Check ConfigReport.log for details.");
+            }
+        }
     }
     
-    // Apply stock behavior at restart for all products (reset, random, destock)
-    private void ApplyStockBehaviorAtRestart()
+    /**
+     * Start the restart stock sweep (reset, random, destock)
+     * @return the products to pass to TraderXProductStockRepository.ApplyRestartBehaviorsRange, slice by slice
+     */
+    array<ref TraderXProduct> BeginRestartStock()
     {
-        array<ref TraderXProduct> products = TraderXProductRepository.GetProducts();
+        TraderXProductStockRepository.Initialize();
+        return TraderXProductRepository.GetProducts();
+    }
+    
+    // Persist every new stock value of the sweep as a single batch
+    void CompleteRestartStock(array<ref TraderXProduct> products, map<string, int> changedStock)
+    {
+        TraderXProductStockRepository.CommitRestartBehaviors(changedStock);
+        
         int processed = 0;
+        foreach (TraderXProduct product : products)
+        {
+            if (product && !product.IsStockUnlimited())
+                processed++;
+        }
+        
+        LogRestartStockSummary(changedStock);
+        GetTraderXLogger().LogInfo(string.Format("[TraderX] Restart stock - Processed %1 products, %2 changed", processed, changedStock.Count()));
+    }
+    
+    // One line per category: limited products and how many were refilled, randomized or destocked
+    private void LogRestartStockSummary(map<string, int> changedStock)
+    {
+        if (!GetTraderXLogger().IsEnabled(TraderXLogLevel.Info))
+            return;
         
-        foreach(TraderXProduct product: products)
+        foreach (TraderXCategory category : TraderXCategoryRepository.GetCategories())
         {
-            if (!product || product.IsStockUnlimited())
+            if (!category || !category.productIds)
+                continue;
+            
+            int limited = 0;
+            int refilled = 0;
+            int randomized = 0;
+            int destocked = 0;
+            int changed = 0;
+            foreach (string productId : category.productIds)
+            {
+                TraderXProduct product = TraderXProductRepository.GetItemById(productId);
+                if (!product || product.IsStockUnlimited())
+                    continue;
+                
+                limited++;
+                if (!changedStock.Contains(productId))
+                    continue;
+                
+                changed++;
+                int behavior = product.GetStockBehaviorAtRestart();
+                if (behavior == 1)
+                    refilled++;
+                else if (behavior == 2)
+                    randomized++;
+                
+                if (product.IsDeStockEnabled())
+                    destocked++;
+            }
+            
+            if (limited == 0)
                 continue;
             
-            product.LoadCategoryStock();
-            processed++;
+            GetTraderXLogger().LogInfo(string.Format("[STOCK] Restart %1: %2 limited products, %3 changed (refilled %4, randomized %5, destocked %6)", category.categoryName, limited, changed, refilled, randomized, destocked));
         }
-        
-        GetTraderXLogger().LogInfo(string.Format("[TraderX] ApplyStockBehaviorAtRestart - Processed %1 products", processed));
     }
     
     // Helper: Check if Source directory has any CSV or JSON files
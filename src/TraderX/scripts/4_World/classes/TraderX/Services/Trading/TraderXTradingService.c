@@ -16,6 +16,7 @@ class TraderXTradingService
 {
     ref array<ref TraderXCategory> traderCategories;
     ref TraderXNpc traderNpc;
+    ref TraderXTraderProductIndex productIndex;
     static ref TraderXTradingService m_instanceTraderXTradingService;
     static ref ScriptInvoker Event_OnTraderXResponseReceived = new ScriptInvoker();
     private bool isMaxQuantity = false;
@@ -26,6 +27,7 @@ class TraderXTradingService
     void TraderXTradingService()
     {
         traderCategories = new array<ref TraderXCategory>();
+        productIndex = new TraderXTraderProductIndex();
     }
 
     void SetTraderNpc(TraderXNpc npc)
@@ -33,13 +35,17 @@ class TraderXTradingService
         GetTraderXLogger().LogDebug("SetTraderCategoriesFromNpc " + npc.npcId );
         traderNpc = npc;
 
-        GetRPCManager().SendRPC("TraderX", "OnTraderXMenuOpen", new Param1<int>(traderNpc.npcId), true, null);
+        // Only the stock changed since our last snapshot of this npc is sent back
+        int knownStockVersion = TraderXProductStockRepository.GetKnownStockVersion(traderNpc.npcId);
+        GetRPCManager().SendRPC("TraderX", "OnTraderXMenuOpen", new Param2<int, int>(traderNpc.npcId, knownStockVersion), true, null);
         
         traderCategories.Clear();
         foreach(UUID categoryId : npc.categoriesId)
         {
             traderCategories.Insert(TraderXCategoryRepository.GetCategoryById(categoryId));
         }
+
+        productIndex.Build(traderCategories);
     }
 
     void SetTradeMode(int mode)
@@ -70,6 +76,7 @@ class TraderXTradingService
         }
         
         traderCategories.Clear();
+        productIndex.Clear();
     }
 
     int GetNpcId()
@@ -79,6 +86,10 @@ class TraderXTradingService
 
     int GetPlayerMoneyAmount(PlayerBase player)
     {
+        TraderXNpcTradeView npcView = TraderXNpcTradeViewRepository.GetView(GetNpcId());
+        if (npcView)
+            return TraderXCurrencyService.GetInstance().GetPlayerMoneyForTrader(player, npcView);
+
         TStringArray acceptedCurrencyTypes = traderNpc.GetCurrenciesAccepted();
         return TraderXCurrencyService.GetInstance().GetPlayerMoneyFromAllCurrency(player, acceptedCurrencyTypes);
     }
@@ -146,32 +157,46 @@ class TraderXTradingService
         array<EntityAI> playerItems = new array<EntityAI>();
         TraderXInventoryManager.GetPlayerEntitiesFromSlotId(player, slotId, playerItems);
 
-        foreach(TraderXCategory category : traderCategories)
+        // Matches are collected per category so the sell list stays grouped in trader category order
+        array<ref array<ref TraderXProduct>> itemsByCategory = new array<ref array<ref TraderXProduct>>();
+        for (int i = 0; i < traderCategories.Count(); i++)
         {
-            GetTraderXLogger().LogDebug("GetTraderXProductsFromSlotId category: " + category.categoryName);
-            foreach(EntityAI playerItem : playerItems)
-            {
-                if(!playerItem)
-                    continue;
+            itemsByCategory.Insert(new array<ref TraderXProduct>());
+        }
 
-                GetTraderXLogger().LogDebug("GetTraderXProductsFromSlotId playerItem: " + playerItem.GetType());
-                TraderXProduct traderXItem = category.FindProductByClassName(playerItem.GetType());
-                if(!traderXItem)
-                    continue;
+        foreach(EntityAI playerItem : playerItems)
+        {
+            if(!playerItem)
+                continue;
+
+            // One entry per trader category selling this className
+            array<TraderXProduct> traderXItems = productIndex.FindProducts(playerItem.GetType());
+            if(!traderXItems)
+                continue;
+
+            TIntArray categoryIndices = productIndex.FindCategoryIndices(playerItem.GetType());
+            int depth = playerItem.GetHierarchyLevel();
+
+            int highId = -1;
+            int lowId = -1;
+            playerItem.GetNetworkID(lowId, highId);
 
+            foreach(int match, TraderXProduct traderXItem : traderXItems)
+            {
                 if(!traderXItem.CanBeSold())
                     continue;
 
-                int depth = playerItem.GetHierarchyLevel();
-
-                int highId = -1;
-                int lowId = -1;
-                playerItem.GetNetworkID(lowId, highId);
+                itemsByCategory[categoryIndices[match]].Insert(TraderXProduct.CreateAsPlayerItem(playerItem.GetType(), highId, lowId, depth, traderXItem, playerItem.GetHealthLevel()));
+            }
+        }
 
-                GetTraderXLogger().LogDebug("item: " + playerItem.GetType() + " highId: " + highId + " lowId: " + lowId);
-                items.Insert(TraderXProduct.CreateAsPlayerItem(playerItem.GetType(), highId, lowId, depth, traderXItem, playerItem.GetHealthLevel()));
-                GetTraderXLogger().LogDebug("items count: " + items.Count());	
+        foreach(array<ref TraderXProduct> categoryItems : itemsByCategory)
+        {
+            foreach(TraderXProduct categoryItem : categoryItems)
+            {
+                items.Insert(categoryItem);
             }
         }
+        GetTraderXLogger().LogDebug("GetTraderXProductsFromSlotId items count: " + items.Count());
     }
 }
\ No newline at end of file
@@ -3,6 +3,7 @@ class TraderXTransactionCoordinator
     static ref TraderXTransactionCoordinator m_instance;
     private ref TraderXTransactionService transactionService;
     private ref TraderXTransactionValidator validator;
+    private TraderXTransactionMetrics metrics;
     
     static TraderXTransactionCoordinator GetInstance()
     {
@@ -15,6 +16,7 @@ class TraderXTransactionCoordinator
     {
         transactionService = TraderXTransactionService.GetInstance();
         validator = new TraderXTransactionValidator();
+        metrics = TraderXTransactionMetrics.GetInstance();
     }
     
     array<ref TraderXTransactionResult> ProcessTransactionBatch(TraderXTransactionCollection transactions, PlayerBase player)
@@ -29,6 +31,8 @@ class TraderXTransactionCoordinator
         }
 
         GetTraderXLogger().LogDebug("ProcessTransactionBatch : " + transactions.ToStringFormatted());
+        int batchStart = TraderXTransactionMetrics.StartTimer();
+        metrics.RecordBatchSize(transactions.GetCount());
         
         // Tri des transactions de vente par profondeur (plus profond en premier)
         transactions.SortByDepth();
@@ -41,8 +45,11 @@ class TraderXTransactionCoordinator
             TraderXTransaction transaction = transactions.GetAllTransactions().Get(i);
             GetTraderXLogger().LogDebug("ProcessTransactionBatch : " + transaction.GetTransactionId() + " " + transaction.GetProductId());
             // Validation individuelle de chaque transaction
+            int transactionStart = TraderXTransactionMetrics.StartTimer();
             string validationError;
-            if (!validator.ValidateTransaction(transaction, player, validationError))
+            bool isValid = validator.ValidateTransaction(transaction, player, validationError);
+            metrics.RecordStage(TraderXTransactionMetrics.STAGE_VALIDATE, transactionStart);
+            if (!isValid)
             {
                 GetTraderXLogger().LogDebug("ProcessTransactionBatch : Invalid transaction");
                 // Transaction invalide : ajouter un résultat d'échec
@@ -54,8 +61,10 @@ class TraderXTransactionCoordinator
             // Transaction valide : traiter normalement
             TraderXTransactionResult result = transactionService.ProcessTransaction(transaction, player);
             results.Insert(result);
+            metrics.RecordStage(TraderXTransactionMetrics.STAGE_TRANSACTION, transactionStart);
         }
         
+        metrics.RecordStage(TraderXTransactionMetrics.STAGE_BATCH, batchStart);
         return results;
     }
     
@@ -0,0 +1,151 @@
+/**
+ * TraderXTransactionMetrics - Per-stage latency histograms for the transaction pipeline
+ * Stages are timed with TickCount around validation, pricing, item creation, currency and stock work,
+ * together with the scheduler queue wait and the batch sizes. Every metricsDumpIntervalSeconds the
+ * histograms are written to TRADERX_METRICS_FILE in Prometheus text format for a textfile collector.
+ */
+class TraderXTransactionMetrics
+{
+    static const string STAGE_VALIDATE = "validate";
+    static const string STAGE_PRICING = "pricing";
+    static const string STAGE_ITEM_CREATE = "item_create";
+    static const string STAGE_ITEM_REMOVE = "item_remove";
+    static const string STAGE_CURRENCY = "currency";
+    static const string STAGE_STOCK = "stock";
+    static const string STAGE_STOCK_FLUSH = "stock_flush";
+    static const string STAGE_TRANSACTION = "transaction";
+    static const string STAGE_BATCH = "batch";
+
+    static ref TraderXTransactionMetrics m_instance;
+
+    private ref map<string, ref TraderXLatencyHistogram> m_StageHistograms;
+    private ref TStringArray m_StageOrder;
+    private ref TraderXLatencyHistogram m_QueueWait;
+    private ref TraderXLatencyHistogram m_BatchSize;
+    private float m_DumpDeltaTime;
+
+    static TraderXTransactionMetrics GetInstance()
+    {
+        if (!m_instance)
+            m_instance = new TraderXTransactionMetrics();
+        return m_instance;
+    }
+
+    void TraderXTransactionMetrics()
+    {
+        m_StageHistograms = new map<string, ref TraderXLatencyHistogram>();
+        m_StageOrder = new TStringArray();
+        m_QueueWait = TraderXLatencyHistogram.CreateLatency();
+        m_BatchSize = TraderXLatencyHistogram.CreateSize();
+    }
+
+    // Start a stage timer, pass the result to RecordStage
+    static int StartTimer()
+    {
+        return TickCount(0);
+    }
+
+    void RecordStage(string stage, int startTicks)
+    {
+        TraderXLatencyHistogram histogram = m_StageHistograms.Get(stage);
+        if (!histogram)
+        {
+            histogram = TraderXLatencyHistogram.CreateLatency();
+            m_StageHistograms.Set(stage, histogram);
+            m_StageOrder.Insert(stage);
+        }
+
+        histogram.Record(TraderXTransactionScheduler.TicksToMs(TickCount(startTicks)));
+    }
+
+    void RecordQueueWait(int waitMs)
+    {
+        m_QueueWait.Record(waitMs);
+    }
+
+    void RecordBatchSize(int size)
+    {
+        m_BatchSize.Record(size);
+    }
+
+    TraderXLatencyHistogram GetStageHistogram(string stage)
+    {
+        return m_StageHistograms.Get(stage);
+    }
+
+    void DumpIfDue(float deltaTime)
+    {
+        int interval = TraderXPerformanceSettingsRepository.GetSettings().metricsDumpIntervalSeconds;
+        if (interval <= 0)
+            return;
+
+        m_DumpDeltaTime += deltaTime;
+        if (m_DumpDeltaTime < interval)
+            return;
+
+        m_DumpDeltaTime = 0;
+        Dump();
+    }
+
+    /**
+     * Write every histogram to the metrics file
+     * The file is written aside then swapped in so the collector never reads a partial dump
+     */
+    void Dump()
+    {
+        if (!FileExist(TRADERX_METRICS_DIR))
+            MakeDirectory(TRADERX_METRICS_DIR);
+
+        TStringArray lines = new TStringArray();
+
+        lines.Insert("# HELP traderx_stage_duration_ms Time spent per transaction pipeline stage");
+        lines.Insert("# TYPE traderx_stage_duration_ms histogram");
+        foreach (string stage : m_StageOrder)
+        {
+            m_StageHistograms.Get(stage).AppendExposition(lines, "traderx_stage_duration_ms", "stage=\"" + stage + "\"");
+        }
+
+        lines.Insert("# HELP traderx_stage_duration_quantile_ms Bucketed p50/p95/p99 per stage");
+        lines.Insert("# TYPE traderx_stage_duration_quantile_ms gauge");
+        foreach (string quantileStage : m_StageOrder)
+        {
+            AppendQuantiles(lines, "traderx_stage_duration_quantile_ms", "stage=\"" + quantileStage + "\",", m_StageHistograms.Get(quantileStage));
+        }
+
+        lines.Insert("# HELP traderx_queue_wait_ms Time a request waited in the transaction scheduler");
+        lines.Insert("# TYPE traderx_queue_wait_ms histogram");
+        m_QueueWait.AppendExposition(lines, "traderx_queue_wait_ms", "");
+        lines.Insert("# TYPE traderx_queue_wait_quantile_ms gauge");
+        AppendQuantiles(lines, "traderx_queue_wait_quantile_ms", "", m_QueueWait);
+
+        lines.Insert("# HELP traderx_batch_size Transactions per processed request");
+        lines.Insert("# TYPE traderx_batch_size histogram");
+        m_BatchSize.AppendExposition(lines, "traderx_batch_size", "");
+
+        FileHandle fh = OpenFile(TRADERX_METRICS_TMP_FILE, FileMode.WRITE);
+        if (!fh)
+        {
+            GetTraderXLogger().LogError("[METRICS] Could not write " + TRADERX_METRICS_TMP_FILE);
+            return;
+        }
+
+        foreach (string line : lines)
+        {
+            FPrintln(fh, line);
+        }
+        CloseFile(fh);
+
+        if (FileExist(TRADERX_METRICS_FILE))
+            DeleteFile(TRADERX_METRICS_FILE);
+
+        CopyFile(TRADERX_METRICS_TMP_FILE, TRADERX_METRICS_FILE);
+        DeleteFile(TRADERX_METRICS_TMP_FILE);
+    }
+
+    private void AppendQuantiles(TStringArray lines, string name, string labelPrefix, TraderXLatencyHistogram histogram)
+    {
+        lines.Insert(string.Format("%1{%2quantile=\"0.5\"} %3", name, labelPrefix, histogram.GetPercentile(0.5)));
+        lines.Insert(string.Format("%1{%2quantile=\"0.95\"} %3", name, labelPrefix, histogram.GetPercentile(0.95)));
+        lines.Insert(string.Format("%1{%2quantile=\"0.99\"} %3", name, labelPrefix, histogram.GetPercentile(0.99)));
+    }
+}
@@ -4,6 +4,7 @@ class TraderXTransactionRequest
     private PlayerBase m_Player;
     private ref TraderXTransactionCollection m_TransactionCollection;
     private int m_NpcId;
+    private int m_EnqueuedAt;
     
     void TraderXTransactionRequest(string steamId, PlayerBase player, TraderXTransactionCollection transactionCollection, int npcId)
     {
@@ -38,6 +39,17 @@ class TraderXTransactionRequest
         return m_NpcId;
     }
     
+    // Mission time (ms) at which the request entered the scheduler
+    void SetEnqueuedAt(int time)
+    {
+        m_EnqueuedAt = time;
+    }
+    
+    int GetEnqueuedAt()
+    {
+        return m_EnqueuedAt;
+    }
+    
     bool IsValid()
     {
         return m_SteamId != "" && m_Player && m_TransactionCollection && !m_TransactionCollection.IsEmpty();
@@ -0,0 +1,233 @@
+/**
+ * TraderXTransactionScheduler - Fair, time-budgeted draining of queued transaction requests
+ * Requests are queued per player and served round-robin, so a player sending large batches
+ * only gets one request processed per round while everyone else still gets their turn.
+ */
+class TraderXTransactionScheduler
+{
+    private ref map<string, ref TransactionQueue<ref TraderXTransactionRequest>> m_QueuesBySteamId;
+    private ref array<string> m_RoundRobin;
+    private int m_NextIndex;
+    private int m_PendingCount;
+
+    // Tick budget
+    private int m_TickStart;
+    private int m_TickBudgetTicks;
+    private int m_TickProcessed;
+
+    // Counters
+    private int m_TotalEnqueued;
+    private int m_TotalRejected;
+    private int m_TotalProcessed;
+    private int m_PeakDepth;
+    private int m_MaxWaitMs;
+    private float m_TotalWaitMs;
+    private int m_LastTickProcessed;
+    private float m_LastTickDurationMs;
+    private float m_MaxTickDurationMs;
+
+    void TraderXTransactionScheduler()
+    {
+        m_QueuesBySteamId = new map<string, ref TransactionQueue<ref TraderXTransactionRequest>>();
+        m_RoundRobin = new array<string>();
+    }
+
+    /**
+     * Queue a request behind the player's previous ones
+     * @return false when the global or the per-player capacity is reached
+     */
+    bool EnQueue(TraderXTransactionRequest request)
+    {
+        if (!request)
+            return false;
+
+        TraderXPerformanceSettings perfSettings = TraderXPerformanceSettingsRepository.GetSettings();
+        if (m_PendingCount >= perfSettings.maxQueuedRequests)
+        {
+            m_TotalRejected++;
+            return false;
+        }
+
+        string steamId = request.GetSteamId();
+        TransactionQueue<ref TraderXTransactionRequest> playerQueue = m_QueuesBySteamId.Get(steamId);
+        bool isNewPlayer = !playerQueue;
+        if (isNewPlayer)
+            playerQueue = new TransactionQueue<ref TraderXTransactionRequest>(perfSettings.maxQueuedRequestsPerPlayer, ETraderXQueueOverflowPolicy.REJECT);
+
+        request.SetEnqueuedAt(GetGame().GetTime());
+        if (!playerQueue.EnQueue(request))
+        {
+            m_TotalRejected++;
+            return false;
+        }
+
+        if (isNewPlayer)
+        {
+            m_QueuesBySteamId.Set(steamId, playerQueue);
+            m_RoundRobin.Insert(steamId);
+        }
+
+        m_PendingCount++;
+        m_TotalEnqueued++;
+        if (m_PendingCount > m_PeakDepth)
+            m_PeakDepth = m_PendingCount;
+
+        return true;
+    }
+
+    bool HasPending()
+    {
+        return m_PendingCount > 0;
+    }
+
+    /**
+     * Take the next request in round-robin order across players
+     * @return next request, or null when nothing is pending
+     */
+    TraderXTransactionRequest Next()
+    {
+        if (m_RoundRobin.Count() == 0)
+            return null;
+
+        if (m_NextIndex >= m_RoundRobin.Count())
+            m_NextIndex = 0;
+
+        string steamId = m_RoundRobin[m_NextIndex];
+        TransactionQueue<ref TraderXTransactionRequest> playerQueue = m_QueuesBySteamId.Get(steamId);
+
+        TraderXTransactionRequest request = playerQueue.Peek();
+        playerQueue.DeQueue();
+        m_PendingCount--;
+
+        if (!playerQueue.HasNextQueue())
+        {
+            // Player drained, the next player slides into the current index
+            m_QueuesBySteamId.Remove(steamId);
+            m_RoundRobin.RemoveOrdered(m_NextIndex);
+        }
+        else
+        {
+            m_NextIndex++;
+        }
+
+        RecordWait(request);
+        return request;
+    }
+
+    void BeginTick(float budgetMs)
+    {
+        m_TickStart = TickCount(0);
+        m_TickBudgetTicks = budgetMs * TRADERX_TICKS_PER_MS;
+        m_TickProcessed = 0;
+    }
+
+    // Always lets the first request of a tick through so the queue can't stall
+    bool CanProcessMore()
+    {
+        if (!HasPending())
+            return false;
+
+        if (m_TickProcessed == 0)
+            return true;
+
+        return TickCount(m_TickStart) < m_TickBudgetTicks;
+    }
+
+    void OnRequestProcessed()
+    {
+        m_TickProcessed++;
+        m_TotalProcessed++;
+    }
+
+    void EndTick()
+    {
+        if (m_TickProcessed == 0)
+            return;
+
+        m_LastTickProcessed = m_TickProcessed;
+        m_LastTickDurationMs = TicksToMs(TickCount(m_TickStart));
+        if (m_LastTickDurationMs > m_MaxTickDurationMs)
+            m_MaxTickDurationMs = m_LastTickDurationMs;
+    }
+
+    static float TicksToMs(int ticks)
+    {
+        float elapsed = ticks;
+        return elapsed / TRADERX_TICKS_PER_MS;
+    }
+
+    private void RecordWait(TraderXTransactionRequest request)
+    {
+        if (!request)
+            return;
+
+        int waitMs = GetGame().GetTime() - request.GetEnqueuedAt();
+        m_TotalWaitMs += waitMs;
+        if (waitMs > m_MaxWaitMs)
+            m_MaxWaitMs = waitMs;
+
+        TraderXTransactionMetrics.GetInstance().RecordQueueWait(waitMs);
+    }
+
+    int GetQueueDepth()
+    {
+        return m_PendingCount;
+    }
+
+    int GetQueuedPlayerCount()
+    {
+        return m_RoundRobin.Count();
+    }
+
+    int GetPeakDepth()
+    {
+        return m_PeakDepth;
+    }
+
+    int GetTotalEnqueued()
+    {
+        return m_TotalEnqueued;
+    }
+
+    int GetTotalRejected()
+    {
+        return m_TotalRejected;
+    }
+
+    int GetTotalProcessed()
+    {
+        return m_TotalProcessed;
+    }
+
+    int GetMaxWaitMs()
+    {
+        return m_MaxWaitMs;
+    }
+
+    float GetAverageWaitMs()
+    {
+        if (m_TotalProcessed == 0)
+            return 0;
+
+        return m_TotalWaitMs / m_TotalProcessed;
+    }
+
+    string GetStatsSummary()
+    {
+        return string.Format("[SCHEDULER] depth=%1 players=%2 peak=%3 enqueued=%4 processed=%5 avgWait=%6ms maxWait=%7ms lastTick=%8 req/%9ms",
+            m_PendingCount, m_RoundRobin.Count(), m_PeakDepth, m_TotalEnqueued, m_TotalProcessed,
+            GetAverageWaitMs(), m_MaxWaitMs, m_LastTickProcessed, m_LastTickDurationMs) + string.Format(" maxTick=%1ms rejected=%2", m_MaxTickDurationMs, m_TotalRejected);
+    }
+
+    // Counters are cumulative, reset them after each periodic report
+    void ResetStats()
+    {
+        m_PeakDepth = m_PendingCount;
+        m_TotalEnqueued = 0;
+        m_TotalRejected = 0;
+        m_TotalProcessed = 0;
+        m_MaxWaitMs = 0;
+        m_TotalWaitMs = 0;
+        m_MaxTickDurationMs = 0;
+    }
+}
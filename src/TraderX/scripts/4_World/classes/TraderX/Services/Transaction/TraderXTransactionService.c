@@ -2,19 +2,27 @@ class TraderXTransactionService
 {
     static ref TraderXTransactionService m_instance;
 
+    // (TraderXTransactionRequest request, TraderXTransactionResultCollection results), server side
+    static ref ScriptInvoker Event_OnTransactionRequestProcessed = new ScriptInvoker();
+
     float deltaTime = 0.0;
+    float statsDeltaTime = 0.0;
     
-    const float TRADERX_QUEUE_TRANSACTION_INTERVAL = 0.5;
-    ref TransactionQueue<ref TraderXTransactionRequest> m_TransactionRequestQueue;
+    ref TraderXTransactionScheduler m_TransactionScheduler;
     ref TransactionQueue<ref TraderXTransactionResultCollection> m_TransactionResponseQueue;
     
     
     void TraderXTransactionService()
     {
-        m_TransactionRequestQueue = new TransactionQueue<ref TraderXTransactionRequest>();
+        m_TransactionScheduler = new TraderXTransactionScheduler();
         m_TransactionResponseQueue = new TransactionQueue<ref TraderXTransactionResultCollection>();
     }
     
+    TraderXTransactionScheduler GetScheduler()
+    {
+        return m_TransactionScheduler;
+    }
+    
     static TraderXTransactionService GetInstance()
     {
         if (!m_instance)
@@ -31,7 +39,7 @@ class TraderXTransactionService
         else
         {
             GetRPCManager().AddRPC("TraderX", "OnTransactionsResponse", this, SingeplayerExecutionType.Client);
-            GetRPCManager().AddRPC("TraderX", "OnStockUpdateResponse", this, SingeplayerExecutionType.Client);
+            GetRPCManager().AddRPC("TraderX", "OnStockDeltaResponse", this, SingeplayerExecutionType.Client);
         }
     }
     
@@ -74,13 +82,20 @@ class TraderXTransactionService
             return TraderXTransactionResult.CreateFailure(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), settings.purchaseFailedPrefix + settings.productNotFound);
         }
 
-        TraderXNpc npc = GetTraderXModule().GetSettings().GetNpcById(transaction.GetTraderId());
-        GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Retrieved NPC: %1, TraderId: %2", npc != null, transaction.GetTraderId()));
-        if (npc) {
+        // Most of the trace below is Info level, skip building it when it would be dropped anyway
+        bool logInfo = GetTraderXLogger().IsEnabled(TraderXLogLevel.Info);
+
+        TraderXNpc npc = TraderXNpcTradeViewRepository.GetNpc(transaction.GetTraderId());
+        if (logInfo)
+            GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Retrieved NPC: %1, TraderId: %2", npc != null, transaction.GetTraderId()));
+        if (npc && logInfo) {
             GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] NPC currencies count: %1", npc.GetCurrenciesAccepted().Count()));
         }
         
+        TraderXTransactionMetrics metrics = TraderXTransactionMetrics.GetInstance();
+
         // Calculate price using preset service if preset exists, otherwise use regular pricing
+        int stageStart = TraderXTransactionMetrics.StartTimer();
         TraderXPreset preset = transaction.GetPreset();
         int calculatedPrice;
         
@@ -88,22 +103,26 @@ class TraderXTransactionService
             // Use progressive preset pricing for multipliers to match client calculation
             if (transaction.GetMultiplier() > 1) {
                 calculatedPrice = TraderXPresetsService.GetInstance().CalculateProgressivePresetPrice(preset, transaction.GetMultiplier());
-                GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Progressive preset pricing - Multiplier: %1, Total: %2", transaction.GetMultiplier(), calculatedPrice));
+                if (logInfo)
+                    GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Progressive preset pricing - Multiplier: %1, Total: %2", transaction.GetMultiplier(), calculatedPrice));
             } else {
                 // Single preset - use simple calculation
                 calculatedPrice = TraderXPresetsService.GetInstance().CalculateTotalPricePreset(preset);
-                GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Single preset pricing - Total: %1", calculatedPrice));
+                if (logInfo)
+                    GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Single preset pricing - Total: %1", calculatedPrice));
             }
         } else {
             // Regular dynamic pricing for non-preset items
             TraderXPriceCalculation priceCalculation = TraderXPricingService.GetInstance().CalculateBuyPrice(product, transaction.GetMultiplier());
             calculatedPrice = priceCalculation.GetCalculatedPrice();
         }
+        metrics.RecordStage(TraderXTransactionMetrics.STAGE_PRICING, stageStart);
         
         // Enhanced debugging for price calculation
         int currentStock = TraderXProductStockRepository.GetStockAmount(product.GetProductId());
-        GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Price calculation details - Product: %1 (ID: %2), BasePrice: %3, Coefficient: %4, CurrentStock: %5, Multiplier: %6, CalculatedPrice: %7", 
-            product.className, product.GetProductId(), product.buyPrice, product.coefficient, currentStock, transaction.GetMultiplier(), calculatedPrice));
+        if (logInfo)
+            GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Price calculation details - Product: %1 (ID: %2), BasePrice: %3, Coefficient: %4, CurrentStock: %5, Multiplier: %6, CalculatedPrice: %7", 
+                product.className, product.GetProductId(), product.buyPrice, product.coefficient, currentStock, transaction.GetMultiplier(), calculatedPrice));
         
         // Price validation - reject transactions with -1 price (allow 0 for free items)
         if (calculatedPrice < 0) {
@@ -122,8 +141,9 @@ class TraderXTransactionService
             int priceDifference = Math.AbsInt(calculatedPrice - transactionPrice);
             priceValid = (priceDifference <= maxAllowedDifference);
             
-            GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Preset price validation - Expected: %1, Received: %2, Difference: %3, MaxAllowed: %4, Valid: %5", 
-                calculatedPrice, transactionPrice, priceDifference, maxAllowedDifference, priceValid));
+            if (logInfo)
+                GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Preset price validation - Expected: %1, Received: %2, Difference: %3, MaxAllowed: %4, Valid: %5", 
+                    calculatedPrice, transactionPrice, priceDifference, maxAllowedDifference, priceValid));
         } else {
             // Exact match required for non-preset transactions
             priceValid = (transactionPrice == calculatedPrice);
@@ -171,6 +191,7 @@ class TraderXTransactionService
         }
         
         // Création de l'item principal
+        stageStart = TraderXTransactionMetrics.StartTimer();
         int baseQuantity = TraderXTradeQuantity.GetItemBuyQuantity(product.className, product.tradeQuantity);
         array<ItemBase> allCreatedItems = new array<ItemBase>();
         int j = 0;
@@ -213,7 +234,8 @@ class TraderXTransactionService
                 }
                 
                 allCreatedItems.Insert(item);
-                GetTraderXLogger().LogDebug(string.Format("[TRANSACTION] Created item %1 of %2: %3", (i + 1), transaction.GetMultiplier(), product.className));
+                if (GetTraderXLogger().IsEnabled(TraderXLogLevel.Debug))
+                    GetTraderXLogger().LogDebug(string.Format("[TRANSACTION] Created item %1 of %2: %3", (i + 1), transaction.GetMultiplier(), product.className));
                 
                 // Application du preset (attachments) for each item if preset exists
                 if (preset && preset.attachments && preset.attachments.Count() > 0) {
@@ -239,9 +261,13 @@ class TraderXTransactionService
             return TraderXTransactionResult.CreateFailure(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), settings.purchaseFailedPrefix + "Item creation count validation failed");
         }
         
-        GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Successfully created %1 items of type %2", allCreatedItems.Count(), product.className));
+        metrics.RecordStage(TraderXTransactionMetrics.STAGE_ITEM_CREATE, stageStart);
+
+        if (logInfo)
+            GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Successfully created %1 items of type %2", allCreatedItems.Count(), product.className));
         
         // Mise à jour du stock principal
+        stageStart = TraderXTransactionMetrics.StartTimer();
         if (!product.IsStockUnlimited()) {
             TraderXProductStockRepository.DecreaseStock(transaction.GetProductId(), transaction.GetMultiplier());
         }
@@ -250,13 +276,18 @@ class TraderXTransactionService
         if (preset && preset.attachments && preset.attachments.Count() > 0) {
             UpdatePresetAttachmentStock(preset);
         }
+        metrics.RecordStage(TraderXTransactionMetrics.STAGE_STOCK, stageStart);
         
         // Retrait de la monnaie - skip if price is zero (free items)
         int tTotalPrice = transaction.GetTotalPrice().GetAmount();
-        GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Processing payment: totalPrice=%1, npcCurrencies=%2", tTotalPrice, npc.GetCurrenciesAccepted().Count()));
+        if (logInfo)
+            GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Processing payment: totalPrice=%1, npcCurrencies=%2", tTotalPrice, npc.GetCurrenciesAccepted().Count()));
         if (tTotalPrice > 0) {
+            stageStart = TraderXTransactionMetrics.StartTimer();
             bool currencyResult = TraderXCurrencyService.GetInstance().RemoveMoneyAmountFromPlayer(player, tTotalPrice, npc.GetCurrenciesAccepted());
-            GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Currency removal result: %1", currencyResult));
+            metrics.RecordStage(TraderXTransactionMetrics.STAGE_CURRENCY, stageStart);
+            if (logInfo)
+                GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Currency removal result: %1", currencyResult));
             if (!currencyResult) {
                 // Rollback: remove all created items and restore stock
                 for (int k = 0; k < allCreatedItems.Count(); k++) {
@@ -392,14 +423,19 @@ class TraderXTransactionService
             return TraderXTransactionResult.CreateFailure(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), settings.saleFailedPrefix + settings.itemNotFoundInInventory);
         }
         
+        TraderXTransactionMetrics metrics = TraderXTransactionMetrics.GetInstance();
+
         // Get the actual item condition for accurate pricing
         int itemState = itemToRemove.GetHealthLevel();
         
         // Calculate dynamic sell price based on current stock, coefficient, and actual item condition
+        int stageStart = TraderXTransactionMetrics.StartTimer();
         TraderXPriceCalculation priceCalculation = TraderXPricingService.GetInstance().CalculateSellPrice(product, transaction.GetMultiplier(), itemState);
         int calculatedPrice = priceCalculation.GetCalculatedPrice();
+        metrics.RecordStage(TraderXTransactionMetrics.STAGE_PRICING, stageStart);
         
-        GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Sell price calculation - Product: %1, ItemState: %2, BasePrice: %3, CalculatedPrice: %4", product.className, itemState, product.sellPrice, calculatedPrice));
+        if (GetTraderXLogger().IsEnabled(TraderXLogLevel.Info))
+            GetTraderXLogger().LogInfo(string.Format("[TRANSACTION] Sell price calculation - Product: %1, ItemState: %2, BasePrice: %3, CalculatedPrice: %4", product.className, itemState, product.sellPrice, calculatedPrice));
         
         // Price validation - reject transactions with -1 price (item cannot be sold)
         if (calculatedPrice < 0) {
@@ -421,7 +457,7 @@ class TraderXTransactionService
         }
         
         // Récupération des données complémentaires
-        TraderXNpc npc = GetTraderXModule().GetSettings().GetNpcById(transaction.GetTraderId());
+        TraderXNpc npc = TraderXNpcTradeViewRepository.GetNpc(transaction.GetTraderId());
         
         if (!npc) {
             return TraderXTransactionResult.CreateFailure(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), settings.saleFailedPrefix + settings.traderNotFound);
@@ -435,34 +471,73 @@ class TraderXTransactionService
         }
         
         // Retrait de l'item du joueur
+        stageStart = TraderXTransactionMetrics.StartTimer();
         int remainingQty = TraderXInventoryManager.RemoveItem(player, itemToRemove, TraderXTradeQuantity.GetItemSellQuantity(product.className, product.tradeQuantity, TraderXQuantityManager.GetItemAmount(itemToRemove)) * transaction.GetMultiplier());
+        metrics.RecordStage(TraderXTransactionMetrics.STAGE_ITEM_REMOVE, stageStart);
         
         // Mise à jour du stock
+        stageStart = TraderXTransactionMetrics.StartTimer();
         if (!product.IsStockUnlimited()) {
             TraderXProductStockRepository.IncreaseStock(transaction.GetProductId(), transaction.GetMultiplier());
         }
+        metrics.RecordStage(TraderXTransactionMetrics.STAGE_STOCK, stageStart);
         
         // Ajout de la monnaie au joueur
+        stageStart = TraderXTransactionMetrics.StartTimer();
         TraderXCurrencyService.GetInstance().AddMoneyToPlayer(player, transaction.GetTotalPrice().GetAmount(), npc.GetCurrenciesAccepted());
+        metrics.RecordStage(TraderXTransactionMetrics.STAGE_CURRENCY, stageStart);
         
         return TraderXTransactionResult.CreateSuccess(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), settings.saleSuccessful);
     }
 
     void ProcessTransactionQueue(float dt)
     {
+        TraderXPerformanceSettings perfSettings = TraderXPerformanceSettingsRepository.GetSettings();
+        
+        LogSchedulerStats(dt, perfSettings);
+        
+        TraderXTransactionMetrics.GetInstance().DumpIfDue(dt);
+        
         this.deltaTime += dt;
-        if (this.deltaTime <= TRADERX_QUEUE_TRANSACTION_INTERVAL) 
+        if (this.deltaTime < perfSettings.transactionQueueIntervalSeconds) 
             return;
         
         this.deltaTime = 0;
-        if (!m_TransactionRequestQueue.HasNextQueue())
+        if (!m_TransactionScheduler.HasPending())
             return;
-            
-        // Process the first transaction request in the queue
-        TraderXTransactionRequest request = m_TransactionRequestQueue.Peek();
-        m_TransactionRequestQueue.DeQueue();
-
-        GetTraderXLogger().LogDebug("ProcessTransactionQueue : " + request.GetTransactionCount());
+        
+        // Drain as many requests as the frame budget allows, round-robin across players
+        m_TransactionScheduler.BeginTick(perfSettings.transactionTimeBudgetMs);
+        while (m_TransactionScheduler.CanProcessMore())
+        {
+            TraderXTransactionRequest request = m_TransactionScheduler.Next();
+            ProcessTransactionRequest(request);
+            m_TransactionScheduler.OnRequestProcessed();
+        }
+        m_TransactionScheduler.EndTick();
+    }
+    
+    private void LogSchedulerStats(float dt, TraderXPerformanceSettings perfSettings)
+    {
+        if (perfSettings.transactionStatsLogIntervalSeconds <= 0)
+            return;
+        
+        this.statsDeltaTime += dt;
+        if (this.statsDeltaTime < perfSettings.transactionStatsLogIntervalSeconds)
+            return;
+        
+        this.statsDeltaTime = 0;
+        if (m_TransactionScheduler.GetTotalEnqueued() == 0 && m_TransactionScheduler.GetTotalRejected() == 0 && !m_TransactionScheduler.HasPending())
+            return;
+        
+        GetTraderXLogger().LogInfo(m_TransactionScheduler.GetStatsSummary());
+        m_TransactionScheduler.ResetStats();
+    }
+    
+    private void ProcessTransactionRequest(TraderXTransactionRequest request)
+    {
+        if (request)
+            GetTraderXLogger().LogDebug("ProcessTransactionQueue : " + request.GetTransactionCount());
         
         // Get debug service instance once for the entire method
         TraderXDebugModeService debugService = TraderXDebugModeService.GetInstance();
@@ -475,7 +550,7 @@ class TraderXTransactionService
             GetTraderXLogger().LogDebug("ProcessTransactionQueue : Invalid request");
             
             // Capture failed transaction if debug mode is enabled and player is authorized admin
-            if (debugService.IsDebugModeEnabled() && request && request.GetPlayer() && request.GetTransactionCollection())
+            if (debugService.IsDebugModeEnabled() && request && request.GetPlayer() && request.GetPlayer().GetIdentity() && request.GetTransactionCollection())
             {
                 playerId = request.GetPlayer().GetIdentity().GetPlainId();
                 
@@ -495,7 +570,7 @@ class TraderXTransactionService
         GetTraderXLogger().LogDebug("ProcessTransactionQueue : " + request.GetTransactionCollection().ToStringFormatted());
         
         // Begin transaction capture if debug mode is enabled and player is authorized admin
-        if (debugService.IsDebugModeEnabled())
+        if (debugService.IsDebugModeEnabled() && request.GetPlayer().GetIdentity())
         {
             playerId = request.GetPlayer().GetIdentity().GetPlainId();
             if (debugSettings.IsAuthorizedAdmin(playerId))
@@ -516,7 +591,7 @@ class TraderXTransactionService
         TraderXTransactionResultCollection resultCollection = TraderXTransactionResultCollection.Create(request.GetSteamId(), results);
         
         // Complete transaction capture if debug mode is enabled and player is authorized admin
-        if (debugService.IsDebugModeEnabled())
+        if (debugService.IsDebugModeEnabled() && request.GetPlayer().GetIdentity())
         {
             playerId = request.GetPlayer().GetIdentity().GetPlainId();
             
@@ -528,32 +603,29 @@ class TraderXTransactionService
             }
         }
         
+        Event_OnTransactionRequestProcessed.Invoke(request, resultCollection);
+        
         // Send the response to the client
         SendTransactionResponse(resultCollection, request.GetPlayer().GetIdentity());
     }
 
-    void ProcessTransactionResponseQueue(float deltaTime)
+    // Client side: hand every response received since the last frame to the trading service
+    void ProcessTransactionResponseQueue()
     {
-        this.deltaTime += deltaTime;
-        if (this.deltaTime <= TRADERX_QUEUE_TRANSACTION_INTERVAL) 
-            return;
-        
-        this.deltaTime = 0;
-        if (m_TransactionResponseQueue.Count() == 0)
-            return;
+        while (m_TransactionResponseQueue.Count() > 0)
+        {
+            TraderXTransactionResultCollection resultCollection = m_TransactionResponseQueue.Peek();
+            m_TransactionResponseQueue.DeQueue();
             
-        // Traiter la première réponse de transaction
-        TraderXTransactionResultCollection resultCollection = m_TransactionResponseQueue.Peek();
-        m_TransactionResponseQueue.DeQueue();
-        
-        if (!resultCollection)
-            return;
+            if (!resultCollection)
+                continue;
 
-        GetTraderXLogger().LogDebug("[TEST] TraderXTransactionService::ProcessTransactionResponseQueue");
-        GetTraderXLogger().LogDebug("[TEST] TraderXTransactionService::ProcessTransactionResponseQueue : " + resultCollection.ToStringFormatted());
-            
-        // Notifier le service de trading des résultats
-        TraderXTradingService.GetInstance().OnTraderXResponseReceived(ETraderXResponse.TRANSACTIONS, resultCollection);
+            GetTraderXLogger().LogDebug("[TEST] TraderXTransactionService::ProcessTransactionResponseQueue");
+            GetTraderXLogger().LogDebug("[TEST] TraderXTransactionService::ProcessTransactionResponseQueue : " + resultCollection.ToStringFormatted());
+                
+            // Notifier le service de trading des résultats
+            TraderXTradingService.GetInstance().OnTraderXResponseReceived(ETraderXResponse.TRANSACTIONS, resultCollection);
+        }
     }
     
     private void SendTransactionResponse(TraderXTransactionResultCollection resultCollection, PlayerIdentity playerIdentity)
@@ -561,45 +633,10 @@ class TraderXTransactionService
         if (!resultCollection || !playerIdentity)
             return;
             
+        // Updated stock follows through TraderXNpcSessionService.BroadcastStockChanges at the end of the frame
         GetRPCManager().SendRPC("TraderX", "OnTransactionsResponse", new Param1<TraderXTransactionResultCollection>(resultCollection), true, playerIdentity);
-        
-        // Send updated stock data to client
-        SendUpdatedStockToClient(resultCollection, playerIdentity);
     }
     
-    private void SendUpdatedStockToClient(TraderXTransactionResultCollection resultCollection, PlayerIdentity playerIdentity)
-    {
-        // Collect unique product IDs from all transactions
-        array<string> updatedProductIds = new array<string>();
-        array<ref TraderXTransactionResult> results = resultCollection.GetTransactionResults();
-        
-        foreach (TraderXTransactionResult result : results)
-        {
-            string productId = result.GetProductId();
-            if (updatedProductIds.Find(productId) == -1) // Avoid duplicates
-            {
-                updatedProductIds.Insert(productId);
-            }
-        }
-        
-        // Get current stock for these products
-        array<ref TraderXProductStock> updatedStocks = new array<ref TraderXProductStock>();
-        foreach (string prodId : updatedProductIds)
-        {
-            TraderXProductStock stock = TraderXProductStockRepository.GetStockByProductId(prodId);
-            if (stock)
-            {
-                updatedStocks.Insert(stock);
-            }
-        }
-        
-        // Send stock update to client
-        if (updatedStocks.Count() > 0)
-        {
-            GetRPCManager().SendRPC("TraderX", "OnStockUpdateResponse", new Param1<array<ref TraderXProductStock>>(updatedStocks), true, playerIdentity);
-        }
-    }
-
     //RPCs 
     void GetTransactionsRequest(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
     {
@@ -628,11 +665,28 @@ class TraderXTransactionService
         TraderXTransactionRequest request = TraderXTransactionRequest.Create(sender.GetPlainId(), player, transactionCollection, npcId);
         
         // Ajouter à la file d'attente
-        m_TransactionRequestQueue.EnQueue(request);
+        if (!m_TransactionScheduler.EnQueue(request)) {
+            GetTraderXLogger().LogWarning(string.Format("Transaction request rejected for player %1: queue full (%2 pending)", sender.GetPlainId(), m_TransactionScheduler.GetQueueDepth()));
+            SendQueueFullResponse(request, sender);
+            return;
+        }
         
         GetTraderXLogger().LogDebug(string.Format("Transaction request queued for player %1 with %2 transactions", sender.GetPlainId(), transactionCollection.GetCount()));
     }
 
+    private void SendQueueFullResponse(TraderXTransactionRequest request, PlayerIdentity playerIdentity)
+    {
+        TraderXDynamicTranslationSettings settings = TraderXDynamicTranslationRepository.GetSettings();
+        array<ref TraderXTransactionResult> results = new array<ref TraderXTransactionResult>();
+        
+        foreach (TraderXTransaction transaction : request.GetAllTransactions())
+        {
+            results.Insert(TraderXTransactionResult.CreateFailure(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), settings.transactionQueueFull));
+        }
+        
+        GetRPCManager().SendRPC("TraderX", "OnTransactionsResponse", new Param1<TraderXTransactionResultCollection>(TraderXTransactionResultCollection.Create(request.GetSteamId(), results)), true, playerIdentity);
+    }
+
     void OnTransactionsResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
     {
         if(type != CallType.Client)
@@ -658,28 +712,40 @@ class TraderXTransactionService
         GetTraderXLogger().LogDebug(string.Format("Transaction response queued for player %1 with %2 results", resultCollection.GetSteamId(), resultCollection.Count()));
     }
     
-    void OnStockUpdateResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
+    void OnStockDeltaResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
     {
         if(type != CallType.Client)
             return;
 
-        Param1<array<ref TraderXProductStock>> data;
+        Param4<int, int, TIntArray, TIntArray> data;
         if(!ctx.Read(data)){
             return;
         }
 
-        array<ref TraderXProductStock> updatedStocks = data.param1;
-        if (!updatedStocks) {
-            GetTraderXLogger().LogError("OnStockUpdateResponse: Invalid stock data");
+        int npcId = data.param1;
+        TIntArray productIndexes = data.param3;
+        TIntArray stocks = data.param4;
+        if (!productIndexes || !stocks || productIndexes.Count() != stocks.Count()) {
+            GetTraderXLogger().LogError("OnStockDeltaResponse: Invalid stock delta");
             return;
         }
 
-        GetTraderXLogger().LogDebug("OnStockUpdateResponse: Received " + updatedStocks.Count() + " stock updates");
-        
+        GetTraderXLogger().LogDebug("OnStockDeltaResponse: Received " + productIndexes.Count() + " stock updates");
+
         // Update client-side stock repository
-        TraderXProductStockRepository.RefStockToTraderXProduct(updatedStocks);
+        TraderXCatalogService catalogService = TraderXCatalogService.GetInstance();
+        for (int i = 0; i < productIndexes.Count(); i++)
+        {
+            string productId = catalogService.GetProductIdByIndex(productIndexes[i]);
+            if (productId != string.Empty)
+                TraderXProductStockRepository.ApplyStockDelta(productId, stocks[i]);
+        }
+
+        // Deltas only reach open sessions, which always start from a snapshot of that npc
+        if (TraderXProductStockRepository.GetKnownStockVersion(npcId) > 0)
+            TraderXProductStockRepository.SetKnownStockVersion(npcId, data.param2);
         
         // Notify trading service that stock has been updated
         TraderXTradingService.GetInstance().OnTraderXResponseReceived(ETraderXResponse.ALL_STOCK_RECEIVED);
     }
-}
\ No newline at end of file
+}
@@ -50,8 +50,8 @@ class TraderXTransactionValidator
         }
 
         // npc validation
-        TraderXNpc npc = TraderXNpcService.GetInstance().GetNpcById(transaction.GetTraderId());
-        if(!npc){
+        TraderXNpcTradeView npcView = TraderXNpcTradeViewRepository.GetView(transaction.GetTraderId());
+        if(!npcView){
             errorMessage = "Npc wasn't found";
             GetTraderXLogger().LogDebug("ValidateBuyTransaction : " + errorMessage);
             return false;
@@ -59,7 +59,7 @@ class TraderXTransactionValidator
 
         // money validation - skip if price is zero (free items)
         int totalPrice = transaction.GetTotalPrice().GetAmount();
-        if(totalPrice > 0 && TraderXCurrencyService.GetInstance().GetPlayerMoneyFromAllCurrency(player, npc.GetCurrenciesAccepted()) < totalPrice){
+        if(totalPrice > 0 && TraderXCurrencyService.GetInstance().GetPlayerMoneyForTrader(player, npcView) < totalPrice){
             errorMessage = "Not enough money";
             GetTraderXLogger().LogDebug("ValidateBuyTransaction : " + errorMessage);
             return false;
@@ -34,15 +34,15 @@ class TraderXPresetValidationService
         }
 
         // Get trader configuration
-        TraderXNpc npc = GetTraderXModule().GetSettings().GetNpcById(traderId.ToInt());
-        if (!npc)
+        TraderXNpcTradeView npcView = TraderXNpcTradeViewRepository.GetView(traderId.ToInt());
+        if (!npcView)
         {
             GetTraderXLogger().LogError("ValidatePresetForTrader: Trader not found: " + traderId);
             return TraderXTransactionResult.CreateFailure(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), "Security: Invalid trader");
         }
 
         // Validate main product is available from this trader
-        TraderXTransactionResult mainProductValidation = ValidateProductAvailableFromTrader(preset.productId, npc, transaction);
+        TraderXTransactionResult mainProductValidation = ValidateProductAvailableFromTrader(preset.productId, npcView, transaction);
         if (!mainProductValidation.IsSuccess())
         {
             GetTraderXLogger().LogWarning(string.Format("Security Alert: Player attempted to purchase unavailable main product %1 from trader %2", preset.productId, traderId));
@@ -53,7 +53,7 @@ class TraderXPresetValidationService
         for (int i = 0; i < preset.attachments.Count(); i++)
         {
             string attachmentId = preset.attachments.Get(i);
-            TraderXTransactionResult attachmentValidation = ValidateProductAvailableFromTrader(attachmentId, npc, transaction);
+            TraderXTransactionResult attachmentValidation = ValidateProductAvailableFromTrader(attachmentId, npcView, transaction);
             
             if (!attachmentValidation.IsSuccess())
             {
@@ -63,7 +63,7 @@ class TraderXPresetValidationService
         }
 
         // Validate player can afford the total cost
-        TraderXTransactionResult costValidation = ValidatePresetTotalCost(player, preset, npc, transaction);
+        TraderXTransactionResult costValidation = ValidatePresetTotalCost(player, preset, npcView, transaction);
         if (!costValidation.IsSuccess())
         {
             return costValidation;
@@ -74,7 +74,7 @@ class TraderXPresetValidationService
     }
 
     // Validate if a specific product is available from a trader
-    private TraderXTransactionResult ValidateProductAvailableFromTrader(string productId, TraderXNpc npc, TraderXTransaction transaction)
+    private TraderXTransactionResult ValidateProductAvailableFromTrader(string productId, TraderXNpcTradeView npcView, TraderXTransaction transaction)
     {
         // Check if product exists globally first
         TraderXProduct product = TraderXProductRepository.GetItemById(productId);
@@ -84,14 +84,9 @@ class TraderXPresetValidationService
         }
 
         // Check if trader sells this product through their categories
-        array<string> traderCategories = npc.GetCategories();
-        for (int i = 0; i < traderCategories.Count(); i++)
+        if (npcView.SellsProduct(productId))
         {
-            TraderXCategory category = TraderXCategoryRepository.GetCategoryById(traderCategories.Get(i));
-            if (category && category.ContainsProduct(productId))
-            {
-                return TraderXTransactionResult.CreateSuccess(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), "Product available from trader");
-            }
+            return TraderXTransactionResult.CreateSuccess(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), "Product available from trader");
         }
 
         // Product not found in any of trader's categories
@@ -129,7 +124,7 @@ class TraderXPresetValidationService
     }
 
     // Validate total cost of preset against player's available funds
-    private TraderXTransactionResult ValidatePresetTotalCost(PlayerBase player, TraderXPreset preset, TraderXNpc npc, TraderXTransaction transaction)
+    private TraderXTransactionResult ValidatePresetTotalCost(PlayerBase player, TraderXPreset preset, TraderXNpcTradeView npcView, TraderXTransaction transaction)
     {
         int totalCost = 0;
         
@@ -144,8 +139,7 @@ class TraderXPresetValidationService
         if (!player)
             return TraderXTransactionResult.CreateFailure(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), "Security: Invalid player");
         
-        TStringArray acceptedCurrencies = npc.GetCurrenciesAccepted();
-        int playerMoney = TraderXCurrencyService.GetInstance().GetPlayerMoneyFromAllCurrency(player, acceptedCurrencies);
+        int playerMoney = TraderXCurrencyService.GetInstance().GetPlayerMoneyForTrader(player, npcView);
         
         if (playerMoney < totalCost)
         {
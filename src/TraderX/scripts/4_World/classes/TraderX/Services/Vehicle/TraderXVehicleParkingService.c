@@ -272,7 +272,7 @@ class TraderXVehicleParkingService
         array<EntityAI> occupiedVehicles = parkingService.GetOccupiedVehicles(npcId.ToString());
 
         // Get trader's categories to match vehicles against sellable products
-        TraderXNpc npc = GetTraderXModule().GetSettings().GetNpcById(npcId);
+        TraderXNpc npc = TraderXNpcTradeViewRepository.GetNpc(npcId);
         if (!npc) {
             GetTraderXLogger().LogWarning("NPC not found for id: " + npcId);
             return;
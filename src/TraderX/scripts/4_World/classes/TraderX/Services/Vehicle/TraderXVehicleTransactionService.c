@@ -23,19 +23,7 @@ class TraderXVehicleTransactionService
     
     bool IsVehicleProduct(string className)
     {
-        EntityAI ent = EntityAI.Cast(GetGame().CreateObject(className , "0 0 0"));
-        if(!ent)
-          return false;
-    
-        Transport transport;
-        if(Class.CastTo(transport, ent))
-        {
-          GetGame().ObjectDelete(transport);
-          return true;
-        }
-
-        GetGame().ObjectDelete(ent);
-        return false;
+        return TraderXClassMetadataCache.IsTransport(className);
     }
     
     // ===== VEHICLE VALIDATION METHODS =====
@@ -178,7 +166,7 @@ class TraderXVehicleTransactionService
             return TraderXTransactionResult.CreateFailure(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), "Vehicle purchase failed: Product not found");
         }
 
-        TraderXNpc npc = GetTraderXModule().GetSettings().GetNpcById(transaction.GetTraderId());
+        TraderXNpc npc = TraderXNpcTradeViewRepository.GetNpc(transaction.GetTraderId());
         if (!npc) {
             return TraderXTransactionResult.CreateFailure(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), "Vehicle purchase failed: Trader not found");
         }
@@ -338,7 +326,7 @@ class TraderXVehicleTransactionService
         //     return TraderXTransactionResult.CreateFailure(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), "Vehicle sale failed: Vehicle is locked");
         // }
         
-        TraderXNpc npc = GetTraderXModule().GetSettings().GetNpcById(transaction.GetTraderId());
+        TraderXNpc npc = TraderXNpcTradeViewRepository.GetNpc(transaction.GetTraderId());
         if (!npc) {
             return TraderXTransactionResult.CreateFailure(transaction.GetTransactionId(), transaction.GetProductId(), transaction.GetTransactionType(), "Vehicle sale failed: Trader not found");
         }
@@ -135,6 +135,7 @@ class TraderXCurrencyServiceTest
         TestRemoveMoneyAmountFromPlayer_NegativeAmount();
         TestRemoveMoneyAmountFromPlayer_WithChange();
         TestRemoveMoneyAmountFromPlayer_WithExactChange();
+        TestWalletBalance_AfterPartialStackRemoval();
         
         // Edge cases and error handling
         TestNullPlayer();
@@ -354,6 +355,42 @@ class TraderXCurrencyServiceTest
     // Edge Cases and Error Handling Tests
     //----------------------------------------------------------------//
 
+    // A partial removal only changes a stack quantity, the cached wallet must follow it
+    void TestWalletBalance_AfterPartialStackRemoval()
+    {
+        CleanupPlayerInventory();
+        
+        TStringArray eurCurrency = {"EUR"};
+        currencyService.AddMoneyToPlayer(testPlayer, 50000, eurCurrency);
+        AssertEquals("WalletBalance_AfterPartialStackRemoval_Initial", 50000, currencyService.GetPlayerMoneyFromAllCurrency(testPlayer, eurCurrency));
+        
+        ItemBase stack;
+        array<EntityAI> itemsArray = TraderXInventoryManager.GetItemsArray(testPlayer);
+        foreach(EntityAI entity : itemsArray)
+        {
+            if(entity && entity.GetType() == "TraderX_Money_Euro100")
+            {
+                stack = ItemBase.Cast(entity);
+                break;
+            }
+        }
+        
+        if(!stack || TraderXQuantityManager.GetItemAmount(stack) < 3)
+        {
+            AssertTrue("WalletBalance_AfterPartialStackRemoval_StackFound", false);
+            return;
+        }
+        
+        int stackAmount = TraderXQuantityManager.GetItemAmount(stack);
+        int remaining = TraderXInventoryManager.RemoveItem(testPlayer, stack, 2);
+        AssertEquals("WalletBalance_AfterPartialStackRemoval_Removed", 0, remaining);
+        AssertEquals("WalletBalance_AfterPartialStackRemoval_Stack", stackAmount - 2, TraderXQuantityManager.GetItemAmount(stack));
+        AssertEquals("WalletBalance_AfterPartialStackRemoval_Balance", 30000, currencyService.GetPlayerMoneyFromAllCurrency(testPlayer, eurCurrency));
+        
+        TraderXQuantityManager.AddQuantity(stack, 1);
+        AssertEquals("WalletBalance_AfterPartialStackRemoval_Refill", 40000, currencyService.GetPlayerMoneyFromAllCurrency(testPlayer, eurCurrency));
+    }
+
     void TestNullPlayer()
     {
         TStringArray eurCurrency = {"EUR"};
@@ -21,7 +21,7 @@ class TraderXPlayerState
         if (!player) return;
         
         // Get NPC currencies for money calculation
-        TraderXNpc npc = GetTraderXModule().GetSettings().GetNpcById(traderId);
+        TraderXNpc npc = TraderXNpcTradeViewRepository.GetNpc(traderId);
         if (npc)
         {
             currencyTypes = npc.GetCurrenciesAccepted();
@@ -216,7 +216,7 @@ class TraderXTestCaseLoader
     private void SetupPlayerState(PlayerBase player, TraderXPlayerState playerState, int traderId)
     {
         // Set up money
-        TraderXNpc npc = GetTraderXModule().GetSettings().GetNpcById(traderId);
+        TraderXNpc npc = TraderXNpcTradeViewRepository.GetNpc(traderId);
         if (npc && playerState.currencyTypes)
         {
             TraderXCurrencyService.GetInstance().AddMoneyToPlayer(player, playerState.totalMoney);
@@ -283,7 +283,7 @@ class TraderXTestCaseLoader
         // If success was expected, validate money changes
         if (testCase.isSuccessExpected && testCase.postTransactionState)
         {
-            TraderXNpc npc = GetTraderXModule().GetSettings().GetNpcById(testCase.traderId);
+            TraderXNpc npc = TraderXNpcTradeViewRepository.GetNpc(testCase.traderId);
             if (npc)
             {
                 int actualMoney = TraderXCurrencyService.GetInstance().GetPlayerMoneyFromAllCurrency(player, npc.GetCurrenciesAccepted());
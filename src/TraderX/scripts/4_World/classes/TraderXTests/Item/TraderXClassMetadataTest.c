@@ -0,0 +1,68 @@
+// Test class for TraderXClassMetadata, compares what is read from config against a spawned probe
+class TraderXClassMetadataTest
+{
+    // Stackable items, quantity items, plain items, weapons and magazines
+    ref TStringArray probeClassNames = {"TraderX_Money_Euro100", "Rag", "Nail", "BandageDressing", "WaterBottle", "TacticalShirt_Grey", "AKM", "Mag_AKM_30Rnd", "Ammo_762x39"};
+
+    void RunClassMetadataTests()
+    {
+        GetTraderXLogger().LogInfo("=== Starting TraderXClassMetadata Tests ===");
+
+        foreach (string className : probeClassNames)
+        {
+            TestAgainstProbe(className);
+        }
+
+        TestUnknownClass();
+
+        GetTraderXLogger().LogInfo("=== TraderXClassMetadata Tests Completed ===");
+    }
+
+    void TestAgainstProbe(string className)
+    {
+        // Weapons are not ItemBase, probe them as InventoryItem
+        InventoryItem probe = InventoryItem.Cast(GetGame().CreateObject(className, vector.Zero));
+        if (!probe)
+        {
+            GetTraderXLogger().LogWarning(string.Format("[TEST] Skipping %1, class not loaded", className));
+            return;
+        }
+
+        float currentQuantity, minQuantity, maxQuantity;
+        QuantityConversions.GetItemQuantity(probe, currentQuantity, minQuantity, maxQuantity);
+        if (maxQuantity == 0)
+            maxQuantity = 1;
+
+        bool isMagazine = probe.IsInherited(Magazine) && !probe.IsInherited(Ammunition_Base);
+        GetGame().ObjectDelete(probe);
+
+        TraderXClassMetadata metadata = new TraderXClassMetadata(className);
+        AssertEquals(metadata.maxQuantity, maxQuantity, string.Format("Max quantity of %1", className));
+        AssertTrue(metadata.isMagazine == isMagazine, string.Format("Magazine kind of %1", className));
+    }
+
+    void TestUnknownClass()
+    {
+        TraderXClassMetadata metadata = new TraderXClassMetadata("TraderX_Test_NotAClass");
+        AssertTrue(!metadata.Exists(), "Unknown class has no config");
+        AssertEquals(metadata.maxQuantity, 0, "Unknown class max quantity");
+    }
+
+    void AssertEquals(int actual, int expected, string testName)
+    {
+        if (actual == expected) {
+            GetTraderXLogger().LogInfo(string.Format("[TEST PASS] %1 - Expected: %2, Got: %3", testName, expected, actual));
+        } else {
+            GetTraderXLogger().LogError(string.Format("[TEST FAIL] %1 - Expected: %2, Got: %3", testName, expected, actual));
+        }
+    }
+
+    void AssertTrue(bool condition, string testName)
+    {
+        if (condition) {
+            GetTraderXLogger().LogInfo(string.Format("[TEST PASS] %1", testName));
+        } else {
+            GetTraderXLogger().LogError(string.Format("[TEST FAIL] %1", testName));
+        }
+    }
+}
@@ -0,0 +1,291 @@
+/**
+ * TraderXLoadGenerator - Synthetic multi-player load for the transaction engine
+ * Spawns server-side dummy players with the configured loadout and wallet, then feeds randomized
+ * buy, sell and preset batches into the transaction scheduler at loadTestRequestsPerSecond.
+ * Requests take the same path as client ones (scheduler, coordinator, service), only the RPC is skipped.
+ * At the end trades/sec, request latency and server frame time are written to TRADERX_LOAD_TEST_RESULTS_FILE.
+ */
+class TraderXLoadGenerator
+{
+    static const string STEAM_ID_PREFIX = "loadtest_";
+
+    private ref TraderXDebugSettings m_Settings;
+    private ref array<PlayerBase> m_Players;
+    private TraderXNpc m_Npc;
+    private ref array<TraderXProduct> m_BuyProducts;
+    private ref array<TraderXProduct> m_SellProducts;
+    private ref array<TraderXProduct> m_PresetProducts;
+
+    private bool m_IsRunning;
+    private float m_Elapsed;
+    private float m_RequestCredit;
+
+    // Results
+    private int m_RequestsSent;
+    private int m_RequestsRejected;
+    private int m_RequestsCompleted;
+    private int m_TradesSucceeded;
+    private int m_TradesFailed;
+    private ref TraderXLatencyHistogram m_RequestLatency;
+    private ref TraderXLatencyHistogram m_FrameTime;
+
+    void TraderXLoadGenerator(TraderXDebugSettings settings)
+    {
+        m_Settings = settings;
+        m_Players = new array<PlayerBase>();
+        m_BuyProducts = new array<TraderXProduct>();
+        m_SellProducts = new array<TraderXProduct>();
+        m_PresetProducts = new array<TraderXProduct>();
+        m_RequestLatency = TraderXLatencyHistogram.CreateLatency();
+        m_FrameTime = TraderXLatencyHistogram.CreateLatency();
+    }
+
+    void ~TraderXLoadGenerator()
+    {
+        TraderXTransactionService.Event_OnTransactionRequestProcessed.Remove(OnRequestProcessed);
+    }
+
+    bool IsRunning()
+    {
+        return m_IsRunning;
+    }
+
+    bool Start()
+    {
+        if (!SelectNpcAndProducts())
+        {
+            GetTraderXLogger().LogError("[LOAD TEST] No trader with tradable products found, load test aborted");
+            return false;
+        }
+
+        for (int i = 0; i < m_Settings.loadTestPlayers; i++)
+        {
+            PlayerBase player = SpawnDummyPlayer(i);
+            if (player)
+                m_Players.Insert(player);
+        }
+
+        if (m_Players.Count() == 0)
+        {
+            GetTraderXLogger().LogError("[LOAD TEST] Could not spawn dummy players, load test aborted");
+            return false;
+        }
+
+        TraderXTransactionService.Event_OnTransactionRequestProcessed.Insert(OnRequestProcessed);
+        m_IsRunning = true;
+
+        GetTraderXLogger().LogInfo(string.Format("[LOAD TEST] Started: %1 players on trader %2, %3 buy / %4 sell / %5 preset products, target %6 req/s",
+            m_Players.Count(), m_Npc.GetNpcId(), m_BuyProducts.Count(), m_SellProducts.Count(), m_PresetProducts.Count(), m_Settings.loadTestRequestsPerSecond));
+        return true;
+    }
+
+    void OnUpdate(float deltaTime)
+    {
+        if (!m_IsRunning)
+            return;
+
+        m_FrameTime.Record(deltaTime * 1000);
+        m_Elapsed += deltaTime;
+
+        if (m_Elapsed >= m_Settings.loadTestDurationSeconds)
+        {
+            Stop();
+            return;
+        }
+
+        m_RequestCredit += deltaTime * m_Settings.loadTestRequestsPerSecond;
+        while (m_RequestCredit >= 1)
+        {
+            m_RequestCredit -= 1;
+            SendRandomRequest();
+        }
+    }
+
+    void Stop()
+    {
+        if (!m_IsRunning)
+            return;
+
+        m_IsRunning = false;
+        TraderXTransactionService.Event_OnTransactionRequestProcessed.Remove(OnRequestProcessed);
+
+        WriteResults();
+
+        foreach (PlayerBase player : m_Players)
+        {
+            if (player)
+                GetGame().ObjectDelete(player);
+        }
+        m_Players.Clear();
+    }
+
+    private bool SelectNpcAndProducts()
+    {
+        foreach (TraderXNpc npc : GetTraderXModule().GetSettings().traders)
+        {
+            map<string, bool> productIds = TraderXNpcSessionService.GetInstance().GetNpcProductIds(npc.GetNpcId());
+            if (!productIds || productIds.Count() == 0)
+                continue;
+
+            m_BuyProducts.Clear();
+            m_SellProducts.Clear();
+            m_PresetProducts.Clear();
+
+            foreach (string productId, bool _ : productIds)
+            {
+                TraderXProduct product = TraderXProductRepository.GetItemById(productId);
+                if (!product || TraderXVehicleTransactionService.GetInstance().IsVehicleProduct(product.className))
+                    continue;
+
+                if (product.CanBeBought())
+                    m_BuyProducts.Insert(product);
+
+                if (product.CanBeSold())
+                    m_SellProducts.Insert(product);
+
+                if (product.CanBeBought() && TraderXPresetsService.GetInstance().GetServerDefaultPreset(productId))
+                    m_PresetProducts.Insert(product);
+            }
+
+            if (m_BuyProducts.Count() > 0)
+            {
+                m_Npc = npc;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    private PlayerBase SpawnDummyPlayer(int index)
+    {
+        PlayerBase player = PlayerBase.Cast(GetGame().CreateObject("SurvivorM_Jose", Vector(index, 0, 0), false, false));
+        if (!player)
+            return null;
+
+        player.GetInventory().UnlockInventory(HIDE_INV_FROM_SCRIPT);
+        foreach (string className : m_Settings.loadTestLoadout)
+        {
+            player.GetInventory().CreateInInventory(className);
+        }
+
+        TraderXCurrencyService.GetInstance().AddMoneyToPlayer(player, m_Settings.loadTestWalletAmount, m_Npc.GetCurrenciesAccepted());
+        return player;
+    }
+
+    private void SendRandomRequest()
+    {
+        int playerIndex = Math.RandomInt(0, m_Players.Count());
+        PlayerBase player = m_Players[playerIndex];
+        if (!player || !player.IsAlive())
+            return;
+
+        // Keep wallets funded so the run measures trading, not "not enough money"
+        TraderXCurrencyService currencyService = TraderXCurrencyService.GetInstance();
+        if (currencyService.GetPlayerMoneyFromAllCurrency(player, m_Npc.GetCurrenciesAccepted()) < m_Settings.loadTestWalletAmount / 2)
+            currencyService.AddMoneyToPlayer(player, m_Settings.loadTestWalletAmount, m_Npc.GetCurrenciesAccepted());
+
+        TraderXTransactionCollection collection = new TraderXTransactionCollection();
+        int batchSize = Math.RandomIntInclusive(1, m_Settings.loadTestMaxBatchSize);
+        for (int i = 0; i < batchSize; i++)
+        {
+            TraderXTransaction transaction = CreateRandomTransaction(player);
+            if (transaction)
+                collection.AddTransaction(transaction);
+        }
+
+        if (collection.IsEmpty())
+            return;
+
+        TraderXTransactionRequest request = TraderXTransactionRequest.Create(STEAM_ID_PREFIX + playerIndex, player, collection, m_Npc.GetNpcId());
+        m_RequestsSent++;
+        if (!TraderXTransactionService.GetInstance().GetScheduler().EnQueue(request))
+            m_RequestsRejected++;
+    }
+
+    private TraderXTransaction CreateRandomTransaction(PlayerBase player)
+    {
+        float roll = Math.RandomFloat01();
+        if (roll < m_Settings.loadTestSellRatio && m_SellProducts.Count() > 0)
+            return CreateSellTransaction(player, m_SellProducts.GetRandomElement());
+
+        if (roll < m_Settings.loadTestSellRatio + m_Settings.loadTestPresetRatio && m_PresetProducts.Count() > 0)
+        {
+            TraderXProduct presetProduct = m_PresetProducts.GetRandomElement();
+            TraderXPreset preset = TraderXPresetsService.GetInstance().GetServerDefaultPreset(presetProduct.GetProductId());
+            int presetPrice = TraderXPresetsService.GetInstance().CalculateTotalPricePreset(preset);
+            return TraderXTransaction.CreateBuyTransaction(presetProduct, 1, presetPrice, m_Npc.GetNpcId(), preset);
+        }
+
+        // Priced like a client would, against the stock known at send time
+        TraderXProduct product = m_BuyProducts.GetRandomElement();
+        int price = TraderXPricingService.GetInstance().CalculateBuyPrice(product, 1).GetCalculatedPrice();
+        if (price < 0)
+            return null;
+
+        return TraderXTransaction.CreateBuyTransaction(product, 1, price, m_Npc.GetNpcId());
+    }
+
+    // The dummy gets the item first so the sell has a real entity to remove
+    private TraderXTransaction CreateSellTransaction(PlayerBase player, TraderXProduct product)
+    {
+        int quantity = TraderXTradeQuantity.GetItemBuyQuantity(product.className, product.tradeQuantity);
+        ItemBase item = TraderXItemFactory.CreateInInventory(player, product.className, quantity);
+        if (!item)
+            return null;
+
+        int price = TraderXPricingService.GetInstance().CalculateSellPrice(product, 1, item.GetHealthLevel()).GetCalculatedPrice();
+        if (price < 0)
+        {
+            GetGame().ObjectDelete(item);
+            return null;
+        }
+
+        int lowId, highId;
+        item.GetNetworkID(lowId, highId);
+
+        TraderXNetworkIdentifier netId = TraderXNetworkIdentifier.CreateFromIds(lowId, highId);
+        TraderXTransactionPrice priceObj = TraderXTransactionPrice.CreateFromAmount(price);
+        return new TraderXTransaction(TraderXTransactionId.Generate(), TraderXTransactionType.CreateSell(), product.GetProductId(), string.Empty, 1, priceObj, netId, 0, m_Npc.GetNpcId());
+    }
+
+    private void OnRequestProcessed(TraderXTransactionRequest request, TraderXTransactionResultCollection results)
+    {
+        if (!request || request.GetSteamId().IndexOf(STEAM_ID_PREFIX) != 0)
+            return;
+
+        m_RequestsCompleted++;
+        m_RequestLatency.Record(GetGame().GetTime() - request.GetEnqueuedAt());
+
+        foreach (TraderXTransactionResult result : results.GetTransactionResults())
+        {
+            if (result.IsSuccess())
+                m_TradesSucceeded++;
+            else
+                m_TradesFailed++;
+        }
+    }
+
+    private void WriteResults()
+    {
+        string filePath = string.Format(TRADERX_LOAD_TEST_RESULTS_FILE, GetTraderXLogger().GenerateFullTimestamp());
+        FileHandle fh = OpenFile(filePath, FileMode.WRITE);
+        if (!fh)
+        {
+            GetTraderXLogger().LogError("[LOAD TEST] Could not write results to " + filePath);
+            return;
+        }
+
+        float duration = Math.Max(m_Elapsed, 0.001);
+        int trades = m_TradesSucceeded + m_TradesFailed;
+
+        FPrintln(fh, string.Format("players=%1 npc=%2 duration_s=%3 target_req_per_s=%4 max_batch=%5", m_Players.Count(), m_Npc.GetNpcId(), duration, m_Settings.loadTestRequestsPerSecond, m_Settings.loadTestMaxBatchSize));
+        FPrintln(fh, string.Format("requests_sent=%1 requests_rejected=%2 requests_completed=%3", m_RequestsSent, m_RequestsRejected, m_RequestsCompleted));
+        FPrintln(fh, string.Format("trades=%1 trades_succeeded=%2 trades_failed=%3 trades_per_s=%4", trades, m_TradesSucceeded, m_TradesFailed, trades / duration));
+        FPrintln(fh, string.Format("request_latency_ms p50=%1 p95=%2 p99=%3 max=%4", m_RequestLatency.GetPercentile(0.5), m_RequestLatency.GetPercentile(0.95), m_RequestLatency.GetPercentile(0.99), m_RequestLatency.GetMax()));
+        FPrintln(fh, string.Format("frame_time_ms p50=%1 p95=%2 p99=%3 max=%4", m_FrameTime.GetPercentile(0.5), m_FrameTime.GetPercentile(0.95), m_FrameTime.GetPercentile(0.99), m_FrameTime.GetMax()));
+        CloseFile(fh);
+
+        GetTraderXLogger().LogInfo(string.Format("[LOAD TEST] Finished: %1 trades in %2 s (%3 trades/s), results in %4", trades, duration, trades / duration, filePath));
+    }
+}
@@ -23,6 +23,7 @@ class TraderXPricingServiceTest
         // Test multiplier pricing
         TestMultiplierBuyPricing();
         TestMultiplierSellPricing();
+        TestLargeMultiplierPricing();
         
         // Test unlimited stock pricing
         TestUnlimitedStockPricing();
@@ -36,6 +37,9 @@ class TraderXPricingServiceTest
         // Test price validation
         TestPriceValidation();
         
+        // Test progressive preset pricing
+        TestProgressivePresetPricing();
+        
         PrintTestSummary();
     }
     
@@ -207,6 +211,29 @@ class TraderXPricingServiceTest
         GetTraderXLogger().LogInfo(string.Format("[TEST] Multiplier sell price - Expected: %1, Got: %2", expectedPrice, calculatedPrice));
     }
     
+    void TestLargeMultiplierPricing()
+    {
+        GetTraderXLogger().LogInfo("[TEST] Testing large multiplier pricing against the per-unit sum");
+        
+        // 500 rounds bought at once, deep into the stock curve
+        TraderXPriceCalculation calculation = TraderXPriceCalculation.CreateBuyCalculation(2, 0.995, 300, 500, 1.0, false);
+        
+        float totalPrice = 0;
+        for (int i = 0; i < 500; i++) {
+            totalPrice += Math.Pow(0.995, (300 + i - 1)) * 2;
+        }
+        int expectedPrice = Math.Round(totalPrice);
+        
+        // The kernel rounds once on the batch total, float summation order may move it by one
+        int calculatedPrice = calculation.GetCalculatedPrice();
+        AssertTrue(Math.AbsInt(calculatedPrice - expectedPrice) <= 1, "Large multiplier buy price matches per-unit sum");
+        GetTraderXLogger().LogInfo(string.Format("[TEST] Large multiplier buy price - Expected: %1, Got: %2", expectedPrice, calculatedPrice));
+        
+        // Empty stock: the first unit is priced at level 1 like the next one
+        calculation = TraderXPriceCalculation.CreateSellCalculation(100, 1.1, 0, 3, 1.0, false);
+        AssertEquals(calculation.GetCalculatedPrice(), 310, "Sell price from empty stock");
+    }
+    
     void TestUnlimitedStockPricing()
     {
         GetTraderXLogger().LogInfo("[TEST] Testing unlimited stock pricing");
@@ -316,6 +343,53 @@ class TraderXPricingServiceTest
         GetTraderXLogger().LogInfo("[TEST] Price validation completed");
     }
     
+    void TestProgressivePresetPricing()
+    {
+        GetTraderXLogger().LogInfo("[TEST] Testing progressive preset pricing");
+        
+        TraderXProduct mainProduct = TraderXProduct.CreateProduct("test_preset_rifle", 1.2, 10, 1, 1500, 1200);
+        TraderXProductRepository.AddItemToItems(mainProduct);
+        TraderXProduct attachment = TraderXProduct.CreateProduct("test_preset_scope", 1.1, 10, 1, 333, 200);
+        TraderXProductRepository.AddItemToItems(attachment);
+        
+        TraderXProductStock mainStock = TraderXProductStockRepository.GetStockByProductId(mainProduct.GetProductId());
+        mainStock.SetStock(3);
+        TraderXProductStockRepository.Save(mainStock);
+        TraderXProductStock attachmentStock = TraderXProductStockRepository.GetStockByProductId(attachment.GetProductId());
+        attachmentStock.SetStock(4);
+        TraderXProductStockRepository.Save(attachmentStock);
+        
+        // The attachment is listed twice, the bill of materials counts it once with a quantity of 2
+        TraderXPreset preset = new TraderXPreset();
+        preset.presetName = "test_progressive_preset";
+        preset.productId = mainProduct.GetProductId();
+        preset.attachments.Insert(attachment.GetProductId());
+        preset.attachments.Insert(attachment.GetProductId());
+        
+        // Every unit of every component is truncated to int on its own
+        int expectedPrice = 0;
+        for (int i = 0; i < 3; i++) {
+            int mainUnitPrice = Math.Pow(1.2, Math.Max(0, 3 - i - 1)) * 1500;
+            int attachmentUnitPrice = Math.Pow(1.1, Math.Max(0, 4 - i - 1)) * 333;
+            expectedPrice += mainUnitPrice + 2 * attachmentUnitPrice;
+        }
+        
+        TraderXPresetsService.GetInstance().InvalidatePriceCache();
+        int calculatedPrice = TraderXPresetsService.GetInstance().CalculateProgressivePresetPrice(preset, 3);
+        AssertEquals(calculatedPrice, expectedPrice, "Progressive preset price, 3 units");
+        
+        // Below stock 1 every unit costs the base price
+        expectedPrice = 0;
+        for (int j = 0; j < 5; j++) {
+            int mainPrice = Math.Pow(1.2, Math.Max(0, 3 - j - 1)) * 1500;
+            int attachmentPrice = Math.Pow(1.1, Math.Max(0, 4 - j - 1)) * 333;
+            expectedPrice += mainPrice + 2 * attachmentPrice;
+        }
+        
+        calculatedPrice = TraderXPresetsService.GetInstance().CalculateProgressivePresetPrice(preset, 5);
+        AssertEquals(calculatedPrice, expectedPrice, "Progressive preset price past stock, 5 units");
+    }
+    
     void AssertEquals(int actual, int expected, string testName)
     {
         if (actual == expected) {
@@ -8,11 +8,14 @@ static ref TraderXModuleTest GetTraderXModuleTest()
 class TraderXModuleTest: CF_ModuleWorld
 {
     ref TraderXDebugSettings debugSettings;
+    ref TraderXLoadGenerator loadGenerator;
 
     override void OnInit()
 	{
         super.OnInit();
         EnableMissionStart();
+        EnableMissionFinish();
+        EnableUpdate();
     }
 
     void StartUnitTest()
@@ -52,12 +55,31 @@ class TraderXModuleTest: CF_ModuleWorld
             //RunPricingServiceTests();
         }
         
+        if (debugSettings.runClassMetadataTests)
+        {
+            RunClassMetadataTests();
+        }
+        
         // if (debugSettings.runVehicleTransactionTests)
         // {
         //     RunVehicleTransactionTests();
         // }
         
         GetTraderXLogger().LogInfo("[TEST RUNNER] All configured test suites completed.");
+        
+        if (debugSettings.runLoadTest)
+        {
+            RunLoadTest(debugSettings);
+        }
+    }
+
+    void RunLoadTest(TraderXDebugSettings settings)
+    {
+        GetTraderXLogger().LogInfo("[TEST RUNNER] Starting load test...");
+        
+        loadGenerator = new TraderXLoadGenerator(settings);
+        if (!loadGenerator.Start())
+            loadGenerator = null;
     }
 
 
@@ -122,6 +144,17 @@ class TraderXModuleTest: CF_ModuleWorld
         GetTraderXLogger().LogInfo("[TEST RUNNER] Pricing Service Tests completed.");
     }
 
+    void RunClassMetadataTests()
+    {
+        GetTraderXLogger().LogInfo("[TEST RUNNER] Running Class Metadata Tests...");
+        
+        TraderXClassMetadataTest metadataTest = new TraderXClassMetadataTest();
+        metadataTest.RunClassMetadataTests();
+        metadataTest = null;
+        
+        GetTraderXLogger().LogInfo("[TEST RUNNER] Class Metadata Tests completed.");
+    }
+
     void RunVehicleTransactionTests()
     {
         GetTraderXLogger().LogInfo("[TEST RUNNER] Running Vehicle Transaction Tests...");
@@ -143,7 +176,40 @@ class TraderXModuleTest: CF_ModuleWorld
 		super.OnMissionStart(sender, args);
         if(GetGame().IsServer())
         {
-            GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(StartUnitTest, 3000);
+            // Startup is spread over frames, the suites need the catalog, settings and npcs in place
+            if (GetTraderXModule().IsInitialized())
+                StartUnitTest();
+            else
+                TraderXModule.Event_OnTraderXServerInitialized.Insert(OnTraderXServerInitialized);
         }
 	}
+
+    void OnTraderXServerInitialized()
+    {
+        TraderXModule.Event_OnTraderXServerInitialized.Remove(OnTraderXServerInitialized);
+        StartUnitTest();
+    }
+
+    override void OnMissionFinish(Class sender, CF_EventArgs args)
+    {
+        super.OnMissionFinish(sender, args);
+        
+        // Still write what was measured when the server stops mid-run
+        if (loadGenerator)
+            loadGenerator.Stop();
+    }
+
+    override void OnUpdate(Class sender, CF_EventArgs args)
+    {
+        super.OnUpdate(sender, args);
+        
+        if (!loadGenerator)
+            return;
+        
+        auto update = CF_EventUpdateArgs.Cast(args);
+        loadGenerator.OnUpdate(update.DeltaTime);
+        
+        if (!loadGenerator.IsRunning())
+            loadGenerator = null;
+    }
 }
@@ -42,8 +42,9 @@
          
          testNpc = new TraderXNpc(1, "SurvivorM_Jose", "Test NPC", "Trader", vector.Zero, vector.Zero, loadouts, categories, currencies);
         
-        // Add test NPC to module settings so it can be found by GetNpcById
+        // Add test NPC to module settings and rebuild the trade views so the services can find it
         GetTraderXModule().GetSettings().traders.Insert(testNpc);
+        GetTraderXModule().RebuildNpcTradeViews();
         
         // Create test product
          testProduct = TraderXProduct.CreateProduct("ammo_556x45", 1, 100, TraderXTradeQuantity.CreateTradeQuantity(TraderXTradeQuantity.BUY_FULL, 0, 0, 0), 100, 10, 0);